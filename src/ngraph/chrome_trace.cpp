@@ -14,10 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
-#include <map>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
@@ -33,9 +39,337 @@ static bool read_tracing_env_var()
     return is_enabled;
 }
 
-mutex event::Manager::s_file_mutex;
 bool event::Manager::s_tracing_enabled = read_tracing_env_var();
 
+namespace
+{
+    // An event as it is buffered. Strings are stored as ids in the StringTable.
+    struct TraceRecord
+    {
+        uint64_t timestamp;
+        uint64_t value;
+        uint32_t name;
+        uint32_t category;
+        uint32_t args;
+        char phase;
+    };
+
+    // Strings of the events, each stored once. Ids are stable, so records can refer to them.
+    class StringTable
+    {
+    public:
+        StringTable() { m_strings.emplace_back(); }
+        uint32_t add(const string& s)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            auto it = m_ids.find(s);
+            if (it != m_ids.end())
+            {
+                return it->second;
+            }
+            uint32_t id = static_cast<uint32_t>(m_strings.size());
+            m_strings.push_back(s);
+            m_ids.insert({s, id});
+            return id;
+        }
+        mutex& get_mutex() { return m_mutex; }
+        // Requires get_mutex() to be held
+        const string& get(uint32_t id) const { return m_strings[id]; }
+
+    private:
+        mutex m_mutex;
+        deque<string> m_strings;
+        unordered_map<string, uint32_t> m_ids;
+    };
+
+    // Ring of the records of one thread. Only the owning thread pushes; records are drained
+    // under the TraceWriter mutex, so there is a single consumer at a time.
+    class ThreadTraceBuffer
+    {
+    public:
+        ThreadTraceBuffer(size_t capacity, const string& thread_id)
+            : m_records(capacity)
+            , m_thread_id(thread_id)
+        {
+        }
+
+        // Returns false, leaving the buffer unchanged, if it is full
+        bool push(const TraceRecord& record)
+        {
+            uint64_t head = m_head.load(memory_order_relaxed);
+            if (head - m_tail.load(memory_order_acquire) == m_records.size())
+            {
+                return false;
+            }
+            m_records[head % m_records.size()] = record;
+            m_head.store(head + 1, memory_order_release);
+            return true;
+        }
+
+        size_t size() const
+        {
+            return m_head.load(memory_order_acquire) - m_tail.load(memory_order_acquire);
+        }
+        size_t capacity() const { return m_records.size(); }
+        template <typename F>
+        void drain(F&& f)
+        {
+            uint64_t tail = m_tail.load(memory_order_relaxed);
+            uint64_t head = m_head.load(memory_order_acquire);
+            for (; tail != head; ++tail)
+            {
+                f(m_records[tail % m_records.size()]);
+            }
+            m_tail.store(tail, memory_order_release);
+        }
+
+        const string& get_thread_id() const { return m_thread_id; }
+        // Ids of the strings this thread has recorded, used without locking the StringTable
+        unordered_map<string, uint32_t> m_string_ids;
+        atomic<bool> m_thread_exited{false};
+
+    private:
+        vector<TraceRecord> m_records;
+        atomic<uint64_t> m_head{0};
+        atomic<uint64_t> m_tail{0};
+        const string m_thread_id;
+    };
+
+    // Owns the trace file and the buffers of all threads, and the thread writing them out
+    class TraceWriter
+    {
+    public:
+        TraceWriter()
+            : m_buffer_capacity(
+                  static_cast<size_t>(max(getenv_int("NGRAPH_TRACE_BUFFER_EVENTS", 16384), 2)))
+        {
+        }
+
+        ~TraceWriter()
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_condition.notify_one();
+            if (m_thread.joinable())
+            {
+                m_thread.join();
+            }
+            close();
+        }
+
+        shared_ptr<ThreadTraceBuffer> add_thread_buffer()
+        {
+            stringstream ss;
+            ss << "\"" << this_thread::get_id() << "\"";
+            auto buffer = make_shared<ThreadTraceBuffer>(m_buffer_capacity, ss.str());
+            lock_guard<mutex> lock(m_mutex);
+            m_buffers.push_back(buffer);
+            if (!m_thread.joinable() && !m_stop)
+            {
+                m_thread = thread(&TraceWriter::run, this);
+            }
+            return buffer;
+        }
+
+        uint32_t get_string_id(ThreadTraceBuffer& buffer, const string& s)
+        {
+            if (s.empty())
+            {
+                return 0;
+            }
+            auto it = buffer.m_string_ids.find(s);
+            if (it != buffer.m_string_ids.end())
+            {
+                return it->second;
+            }
+            uint32_t id = m_strings.add(s);
+            buffer.m_string_ids.insert({s, id});
+            return id;
+        }
+
+        void push(ThreadTraceBuffer& buffer, const TraceRecord& record)
+        {
+            if (!buffer.push(record))
+            {
+                // Full, so write it out on this thread rather than drop the event
+                lock_guard<mutex> lock(m_mutex);
+                write_buffer(buffer);
+                buffer.push(record);
+            }
+            else if (buffer.size() == buffer.capacity() / 2)
+            {
+                m_condition.notify_one();
+            }
+        }
+
+        void open(const string& path)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            open_locked(path);
+        }
+
+        void flush()
+        {
+            lock_guard<mutex> lock(m_mutex);
+            write_buffers();
+            m_out.flush();
+        }
+
+        void close()
+        {
+            lock_guard<mutex> lock(m_mutex);
+            write_buffers();
+            if (m_out.is_open())
+            {
+                m_out << "\n]\n";
+                m_out.close();
+            }
+        }
+
+    private:
+        void run()
+        {
+            unique_lock<mutex> lock(m_mutex);
+            while (!m_stop)
+            {
+                m_condition.wait_for(lock, chrono::milliseconds(100));
+                write_buffers();
+            }
+        }
+
+        void open_locked(const string& path)
+        {
+            if (!m_out.is_open())
+            {
+                m_out.open(path, ios_base::trunc);
+                m_out << "[\n";
+                m_first_event = true;
+            }
+        }
+
+        // Requires m_mutex to be held. Buffers of threads that have exited are released once
+        // they are empty.
+        void write_buffers()
+        {
+            for (auto& buffer : m_buffers)
+            {
+                write_buffer(*buffer);
+            }
+            m_buffers.erase(remove_if(m_buffers.begin(),
+                                      m_buffers.end(),
+                                      [](const shared_ptr<ThreadTraceBuffer>& buffer) {
+                                          return buffer->m_thread_exited && buffer->size() == 0;
+                                      }),
+                            m_buffers.end());
+        }
+
+        // Requires m_mutex to be held
+        void write_buffer(ThreadTraceBuffer& buffer)
+        {
+            if (buffer.size() == 0)
+            {
+                return;
+            }
+            open_locked("runtime_event_trace.json");
+            const string& pid = m_process_id;
+            string str;
+            lock_guard<mutex> lock(m_strings.get_mutex());
+            buffer.drain([&](const TraceRecord& record) {
+                if (!m_first_event)
+                {
+                    str += ",\n";
+                }
+                m_first_event = false;
+                str += R"({"name":")" + m_strings.get(record.name);
+                if (record.phase == 'X')
+                {
+                    str += R"(","cat":")" + m_strings.get(record.category) +
+                           R"(","ph":"X","pid":)" + pid + R"(,"tid":)" +
+                           buffer.get_thread_id() + R"(,"ts":)" + to_string(record.timestamp) +
+                           R"(,"dur":)" + to_string(record.value);
+                }
+                else
+                {
+                    str += R"(","ph":")" + string(1, record.phase) + R"(","id":")" +
+                           to_string(record.value) + R"(","ts":)" +
+                           to_string(record.timestamp) + R"(,"pid":)" + pid + R"(,"tid":)" +
+                           buffer.get_thread_id();
+                }
+                if (record.args != 0)
+                {
+                    str += R"(,"args":)" + m_strings.get(record.args);
+                }
+                str += "}";
+            });
+            m_out << str;
+        }
+
+        const size_t m_buffer_capacity;
+        const string m_process_id{to_string(getpid())};
+        StringTable m_strings;
+        mutex m_mutex;
+        condition_variable m_condition;
+        thread m_thread;
+        bool m_stop{false};
+        vector<shared_ptr<ThreadTraceBuffer>> m_buffers;
+        ofstream m_out;
+        bool m_first_event{true};
+    };
+
+    // Set once s_trace_writer is destroyed, after which events are ignored
+    bool s_trace_writer_destroyed = false;
+
+    struct TraceWriterHolder
+    {
+        ~TraceWriterHolder() { s_trace_writer_destroyed = true; }
+        TraceWriter writer;
+    } s_trace_writer;
+
+    // Marks the buffer of a thread as released when the thread exits
+    struct ThreadTraceBufferHolder
+    {
+        ~ThreadTraceBufferHolder()
+        {
+            if (buffer)
+            {
+                buffer->m_thread_exited = true;
+            }
+        }
+        shared_ptr<ThreadTraceBuffer> buffer;
+    };
+
+    thread_local ThreadTraceBufferHolder t_trace_buffer;
+}
+
+void event::Manager::record(char phase,
+                            const string& name,
+                            const string& category,
+                            const string& args,
+                            size_t timestamp,
+                            size_t value)
+{
+    if (s_trace_writer_destroyed)
+    {
+        return;
+    }
+    TraceWriter& writer = s_trace_writer.writer;
+    if (!t_trace_buffer.buffer)
+    {
+        t_trace_buffer.buffer = writer.add_thread_buffer();
+    }
+    ThreadTraceBuffer& buffer = *t_trace_buffer.buffer;
+    TraceRecord record;
+    record.timestamp = timestamp;
+    record.value = value;
+    record.name = writer.get_string_id(buffer, name);
+    record.category = writer.get_string_id(buffer, category);
+    record.args = writer.get_string_id(buffer, args);
+    record.phase = phase;
+    writer.push(buffer, record);
+}
+
 event::Duration::Duration(const string& name, const string& category, const string& args)
 {
     if (Manager::is_tracing_enabled())
@@ -61,30 +395,7 @@ void event::Duration::write()
     if (Manager::is_tracing_enabled())
     {
         size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
-
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            str += ",\n";
-        }
-
-        str +=
-            R"({"name":")" + m_name + R"(","cat":")" + m_category + R"(","ph":"X","pid":)" +
-            Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id() +
-            R"(,"ts":)" + to_string(m_start) + R"(,"dur":)" + to_string(stop_time - m_start);
-        if (!m_args.empty())
-        {
-            str += R"(,"args":)" + m_args;
-        }
-        str += "}";
-        out << str;
+        Manager::record('X', m_name, m_category, m_args, m_start, stop_time - m_start);
     }
 }
 
@@ -94,28 +405,9 @@ event::Object::Object(const string& name, const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            str += ",\n";
-        }
-        str += R"({"name":")" + m_name + R"(","ph":"N","id":")" + to_string(m_id) +
-               R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-               R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
-        if (!args.empty())
-        {
-            str += R"(,"args":)" + args;
-        }
-        str += "}";
-
-        write_snapshot(out, args);
+        size_t now = Manager::get_current_microseconds();
+        Manager::record('N', m_name, "", args, now, m_id);
+        Manager::record('O', m_name, "", args, now, m_id);
     }
 }
 
@@ -123,86 +415,40 @@ void event::Object::snapshot(const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        write_snapshot(out, args);
+        Manager::record('O', m_name, "", args, Manager::get_current_microseconds(), m_id);
     }
 }
 
-void event::Object::write_snapshot(ostream& out, const string& args)
-{
-    string str = R"({"name":")" + m_name + R"(","ph":"O","id":")" + to_string(m_id) +
-                 R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                 R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
-    if (!args.empty())
-    {
-        str += R"(,"args":)" + args;
-    }
-    str += "}";
-    out << str;
-}
-
 void event::Object::destroy()
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        string str = R"({"name":")" + m_name + R"(","ph":"D","id":")" + to_string(m_id) +
-                     R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                     R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" +
-                     Manager::get_thread_id() + "}";
+        Manager::record('D', m_name, "", "", Manager::get_current_microseconds(), m_id);
     }
 }
 
 void event::Manager::open(const string& path)
 {
-    ofstream& out = get_output_stream();
-    if (out.is_open() == false)
+    if (!s_trace_writer_destroyed)
     {
-        out.open(path, ios_base::trunc);
-        out << "[\n";
+        s_trace_writer.writer.open(path);
     }
 }
 
-void event::Manager::close()
+void event::Manager::flush()
 {
-    ofstream& out = get_output_stream();
-    if (out.is_open())
+    if (!s_trace_writer_destroyed)
     {
-        out << "\n]\n";
-        out.close();
+        s_trace_writer.writer.flush();
     }
 }
 
-ofstream& event::Manager::get_output_stream()
-{
-    static ofstream s_event_log;
-    return s_event_log;
-}
-
-const string& event::Manager::get_process_id()
+void event::Manager::close()
 {
-    static const string s_pid = to_string(getpid());
-    return s_pid;
+    if (!s_trace_writer_destroyed)
+    {
+        s_trace_writer.writer.close();
+    }
 }
 
 void event::Manager::enable_event_tracing()
@@ -219,23 +465,3 @@ bool event::Manager::is_event_tracing_enabled()
 {
     return s_tracing_enabled;
 }
-
-string event::Manager::get_thread_id()
-{
-    thread::id tid = this_thread::get_id();
-    static map<thread::id, string> tid_map;
-    auto it = tid_map.find(tid);
-    string rc;
-    if (it == tid_map.end())
-    {
-        stringstream ss;
-        ss << "\"" << tid << "\"";
-        rc = ss.str();
-        tid_map.insert({tid, rc});
-    }
-    else
-    {
-        rc = it->second;
-    }
-    return rc;
-}
@@ -73,6 +73,12 @@ namespace ngraph
 //
 // More information about this is at:
 // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
+//
+// Events are not written when they happen. Each thread appends fixed-size records to its own
+// ring buffer without taking a lock, and a background thread periodically converts the records
+// of all threads to json and writes them to the trace file. A thread whose buffer is full
+// writes it out itself. The remaining events are written by flush(), close() and at exit.
+// The number of records buffered per thread is set by NGRAPH_TRACE_BUFFER_EVENTS.
 
 class ngraph::event::Manager
 {
@@ -81,6 +87,8 @@ class ngraph::event::Manager
 
 public:
     static void open(const std::string& path = "runtime_event_trace.json");
+    /// \brief Writes the events buffered by all threads to the trace file
+    static void flush();
     static void close();
     static bool is_tracing_enabled() { return s_tracing_enabled; }
     static void enable_event_tracing();
@@ -88,16 +96,19 @@ public:
     static bool is_event_tracing_enabled();
 
 private:
-    static std::ofstream& get_output_stream();
-    static const std::string& get_process_id();
     static size_t get_current_microseconds()
     {
         return std::chrono::high_resolution_clock::now().time_since_epoch().count() / 1000;
     }
-    static std::string get_thread_id();
-    static std::mutex& get_mutex() { return s_file_mutex; }
-    static std::ostream s_ostream;
-    static std::mutex s_file_mutex;
+    /// \brief Appends an event to the buffer of the calling thread
+    /// \param phase The chrome trace phase of the event, 'X', 'N', 'O' or 'D'
+    /// \param value The duration of an 'X' event, otherwise the id of the object
+    static void record(char phase,
+                       const std::string& name,
+                       const std::string& category,
+                       const std::string& args,
+                       size_t timestamp,
+                       size_t value);
     static bool s_tracing_enabled;
 };
 
@@ -137,7 +148,6 @@ public:
     void destroy();
 
 private:
-    void write_snapshot(std::ostream& out, const std::string& args);
     const std::string m_name;
     size_t m_id{0};
 };
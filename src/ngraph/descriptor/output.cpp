@@ -36,6 +36,7 @@ void descriptor::Output::add_input(Input* input)
     // Keep the inputs in insertion order to keep sorts deterministic
     if (find(m_inputs.begin(), m_inputs.end(), input) == m_inputs.end())
     {
+        Node::topology_changed();
         m_inputs.push_back(input);
     }
 }
@@ -45,6 +46,7 @@ void descriptor::Output::remove_input(Input* input)
     auto it = find(m_inputs.begin(), m_inputs.end(), input);
     if (it != m_inputs.end())
     {
+        Node::topology_changed();
         m_inputs.erase(it);
     }
 }
@@ -20,6 +20,7 @@
 #include <dirent.h>
 #include <ftw.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <unistd.h>
 #endif
@@ -379,3 +380,41 @@ bool file_util::exists(const string& filename)
     struct stat buffer;
     return (stat(filename.c_str(), &buffer) == 0);
 }
+
+file_util::MappedFile::MappedFile(const string& path)
+    : m_data(nullptr)
+    , m_size(get_file_size(path))
+{
+#ifdef _WIN32
+    m_contents = read_file_contents(path);
+    m_data = m_contents.data();
+#else
+    if (m_size == 0)
+    {
+        return;
+    }
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw runtime_error("Could not open file: \"" + path + "\"");
+    }
+    void* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw runtime_error("Could not map file: \"" + path + "\"");
+    }
+    m_data = static_cast<char*>(data);
+#endif
+}
+
+file_util::MappedFile::~MappedFile()
+{
+#ifndef _WIN32
+    if (m_data != nullptr)
+    {
+        munmap(m_data, m_size);
+    }
+#endif
+}
@@ -113,5 +113,28 @@ namespace ngraph
         /// \return true if the path exists, false otherwise
         NGRAPH_API
         bool exists(const std::string& path);
+
+        /// \brief Read-only view of the contents of a file.
+        ///
+        /// Where the platform supports it the file is memory mapped copy-on-write, so pages are
+        /// read in only when touched and writes through get_data() never reach the file.
+        /// Elsewhere the contents are read into memory.
+        class NGRAPH_API MappedFile
+        {
+        public:
+            /// \param path The path of the file to map
+            MappedFile(const std::string& path);
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            char* get_data() const { return m_data; }
+            size_t get_size() const { return m_size; }
+        private:
+            char* m_data;
+            size_t m_size;
+            std::vector<char> m_contents;
+        };
     }
 }
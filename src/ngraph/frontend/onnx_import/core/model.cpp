@@ -24,8 +24,10 @@ namespace ngraph
 {
     namespace onnx_import
     {
-        Model::Model(const ONNX_NAMESPACE::ModelProto& model_proto)
+        Model::Model(const ONNX_NAMESPACE::ModelProto& model_proto,
+                     std::shared_ptr<TensorStorage> tensor_storage)
             : m_model_proto{&model_proto}
+            , m_tensor_storage{std::move(tensor_storage)}
         {
             // Walk through the elements of opset_import field and register operator sets
             // for each domain. An exception UnknownDomain() will raise if the domain is
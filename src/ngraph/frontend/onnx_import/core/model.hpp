@@ -18,10 +18,12 @@
 
 #include <onnx/onnx_pb.h>
 #include <ostream>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
 #include "operator_set.hpp"
+#include "tensor_storage.hpp"
 
 namespace ngraph
 {
@@ -31,7 +33,11 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \param model_proto The model to import
+            /// \param tensor_storage Where initializers of the model can take their data from
+            ///                       without copying it, if anywhere
+            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto,
+                           std::shared_ptr<TensorStorage> tensor_storage = nullptr);
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -46,6 +52,10 @@ namespace ngraph
             {
                 return m_model_proto->producer_version();
             }
+            const std::shared_ptr<TensorStorage>& get_tensor_storage() const
+            {
+                return m_tensor_storage;
+            }
 
             /// \brief Access an operator object by its type name and domain name
             /// The function will return the operator object if it exists, or report an error
@@ -74,6 +84,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<TensorStorage> m_tensor_storage;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -23,6 +24,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "tensor_storage.hpp"
 
 namespace ngraph
 {
@@ -90,6 +92,14 @@ namespace ngraph
                     {
                     }
                 };
+
+                struct external_data_unavailable : ngraph_error
+                {
+                    external_data_unavailable()
+                        : ngraph_error{"tensor has external data but no model to load it from"}
+                    {
+                    }
+                };
             }
         }
 
@@ -384,9 +394,15 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param tensor The tensor proto to wrap
+            /// \param storage Where the raw or external data of the tensor can be taken from
+            ///                without copying. Without it raw data is copied and external data
+            ///                is unavailable.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<TensorStorage> storage = nullptr)
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_storage{std::move(storage)}
             {
                 if (m_shape == Shape{0})
                 {
@@ -411,6 +427,12 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (TensorStorage::has_external_data(*m_tensor_proto))
+                {
+                    auto buffer = get_external_buffer(sizeof(T));
+                    auto it = buffer->get_ptr<T>();
+                    return std::vector<T>(it, it + buffer->size() / sizeof(T));
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -504,11 +526,45 @@ namespace ngraph
             }
 
         private:
+            std::shared_ptr<runtime::AlignedBuffer> get_external_buffer(size_t element_size) const
+            {
+                if (m_storage == nullptr)
+                {
+                    throw error::tensor::external_data_unavailable{};
+                }
+                return m_storage->get_buffer(*m_tensor_proto, element_size);
+            }
+
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+                const size_t byte_size = shape_size(m_shape) * sizeof(T);
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (TensorStorage::has_external_data(*m_tensor_proto) ||
+                    (m_storage != nullptr && m_tensor_proto->has_raw_data()))
+                {
+                    // Reference the model's or the mapped file's memory instead of copying it
+                    auto buffer = get_external_buffer(sizeof(T));
+                    if (buffer->size() == byte_size)
+                    {
+                        constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                }
+                else if (m_tensor_proto->has_raw_data() &&
+                         m_tensor_proto->raw_data().size() == byte_size)
+                {
+                    // One copy straight from the proto rather than through a std::vector
+                    constant = std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                if (constant == nullptr)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -518,6 +574,7 @@ namespace ngraph
 
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
+            std::shared_ptr<TensorStorage> m_storage;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "tensor_storage.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace
+        {
+            template <typename T>
+            std::shared_ptr<runtime::AlignedBuffer> make_buffer(char* data,
+                                                                size_t size,
+                                                                size_t element_size,
+                                                                const T& owner)
+            {
+                if (element_size != 0 && reinterpret_cast<size_t>(data) % element_size != 0)
+                {
+                    auto buffer = std::make_shared<runtime::AlignedBuffer>(size);
+                    std::memcpy(buffer->get_ptr(), data, size);
+                    return buffer;
+                }
+                return std::make_shared<runtime::SharedBuffer<T>>(data, size, owner);
+            }
+        }
+
+        TensorStorage::TensorStorage(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto,
+                                     const std::string& model_dir)
+            : m_model_proto{std::move(model_proto)}
+            , m_model_dir{model_dir}
+        {
+        }
+
+        std::shared_ptr<runtime::AlignedBuffer>
+            TensorStorage::get_buffer(const ONNX_NAMESPACE::TensorProto& tensor,
+                                      size_t element_size)
+        {
+            if (!has_external_data(tensor))
+            {
+                NGRAPH_CHECK(tensor.has_raw_data(), "Tensor '", tensor.name(), "' has no raw data");
+                const std::string& raw_data = tensor.raw_data();
+                return make_buffer(const_cast<char*>(raw_data.data()),
+                                   raw_data.size(),
+                                   element_size,
+                                   m_model_proto);
+            }
+
+            std::string location;
+            size_t offset = 0;
+            size_t length = 0;
+            bool has_length = false;
+            for (const auto& entry : tensor.external_data())
+            {
+                if (entry.key() == "location")
+                {
+                    location = entry.value();
+                }
+                else if (entry.key() == "offset")
+                {
+                    offset = std::stoull(entry.value());
+                }
+                else if (entry.key() == "length")
+                {
+                    length = std::stoull(entry.value());
+                    has_length = true;
+                }
+            }
+            NGRAPH_CHECK(!location.empty(),
+                         "External data of tensor '",
+                         tensor.name(),
+                         "' has no location");
+
+            std::shared_ptr<file_util::MappedFile> file = map_file(location);
+            NGRAPH_CHECK(offset <= file->get_size(),
+                         "External data offset ",
+                         offset,
+                         " of tensor '",
+                         tensor.name(),
+                         "' is past the end of ",
+                         location);
+            if (!has_length)
+            {
+                length = file->get_size() - offset;
+            }
+            NGRAPH_CHECK(length <= file->get_size() - offset,
+                         "External data of tensor '",
+                         tensor.name(),
+                         "' runs past the end of ",
+                         location);
+            return make_buffer(file->get_data() + offset, length, element_size, file);
+        }
+
+        std::shared_ptr<file_util::MappedFile>
+            TensorStorage::map_file(const std::string& location)
+        {
+            auto it = m_mapped_files.find(location);
+            if (it != m_mapped_files.end())
+            {
+                return it->second;
+            }
+            std::string path =
+                m_model_dir.empty() ? location : file_util::path_join(m_model_dir, location);
+            auto file = std::make_shared<file_util::MappedFile>(path);
+            m_mapped_files.emplace(location, file);
+            return file;
+        }
+    }
+}
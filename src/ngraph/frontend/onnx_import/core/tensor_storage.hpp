@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        /// \brief Hands out the bytes of initializers stored as raw_data in the model or as
+        ///        external data in separate files, without copying them where possible.
+        ///
+        /// Raw data is shared with the ModelProto, which is kept alive by every buffer that
+        /// points into it. External data files are memory mapped once each and shared the same
+        /// way. Data that is not aligned for its element type is copied instead.
+        class TensorStorage
+        {
+        public:
+            /// \param model_proto The model the tensors belong to
+            /// \param model_dir The directory external data locations are relative to
+            TensorStorage(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto,
+                          const std::string& model_dir);
+
+            /// \brief Returns the raw bytes of a tensor with raw or external data.
+            /// \param tensor A tensor of the model this storage was created for
+            /// \param element_size The size of one element, used for the alignment check
+            std::shared_ptr<runtime::AlignedBuffer>
+                get_buffer(const ONNX_NAMESPACE::TensorProto& tensor, size_t element_size);
+
+            static bool has_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                return tensor.has_data_location() &&
+                       tensor.data_location() ==
+                           ONNX_NAMESPACE::TensorProto_DataLocation::
+                               TensorProto_DataLocation_EXTERNAL;
+            }
+
+        private:
+            std::shared_ptr<file_util::MappedFile> map_file(const std::string& location);
+
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
+            std::string m_model_dir;
+            std::map<std::string, std::shared_ptr<file_util::MappedFile>> m_mapped_files;
+        };
+    }
+}
@@ -21,7 +21,9 @@
 
 #include "core/graph.hpp"
 #include "core/model.hpp"
+#include "core/tensor_storage.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -52,25 +54,27 @@ namespace ngraph
             } // namespace error
         }     // namespace detail
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_dir)
         {
-            ONNX_NAMESPACE::ModelProto model_proto;
+            // Shared so that Constants can keep pointing at initializer raw data after import
+            auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>();
             // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            if (!model_proto->ParseFromIstream(&stream))
             {
                 // Rewind to the beginning and clear stream state.
                 stream.clear();
                 stream.seekg(0);
                 google::protobuf::io::IstreamInputStream iistream(&stream);
                 // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                if (!google::protobuf::TextFormat::Parse(&iistream, model_proto.get()))
                 {
                     throw detail::error::stream_parse{stream};
                 }
             }
 
-            Model model{model_proto};
-            Graph graph{model_proto.graph(), model};
+            Model model{*model_proto, std::make_shared<TensorStorage>(model_proto, model_dir)};
+            Graph graph{model_proto->graph(), model};
             auto function = std::make_shared<Function>(
                 graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
             for (std::size_t i{0}; i < function->get_output_size(); ++i)
@@ -87,7 +91,10 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            std::string model_dir = file_path.find_last_of('/') == std::string::npos
+                                        ? ""
+                                        : file_util::get_directory(file_path);
+            return import_onnx_model(ifs, model_dir);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -101,6 +102,28 @@ void Function::init()
 
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
+    lock_guard<mutex> lock(m_cached_ordered_ops_mutex);
+    // Read before sorting so that a change made while sorting invalidates the result
+    uint64_t epoch = Node::get_topology_epoch();
+    if (m_cached_ordered_ops_valid && m_cached_ordered_ops_epoch == epoch)
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_cached_ordered_ops.size());
+        for (const weak_ptr<Node>& weak_op : m_cached_ordered_ops)
+        {
+            shared_ptr<Node> op = weak_op.lock();
+            if (!op)
+            {
+                break;
+            }
+            ordered_ops.push_back(move(op));
+        }
+        if (ordered_ops.size() == m_cached_ordered_ops.size())
+        {
+            return ordered_ops;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -111,7 +134,11 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    vector<shared_ptr<Node>> ordered_ops = m_topological_sorter(nodes);
+    m_cached_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    m_cached_ordered_ops_epoch = epoch;
+    m_cached_ordered_ops_valid = true;
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -297,9 +324,12 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    // The parameters are roots of the sort
+    Node::topology_changed();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    Node::topology_changed();
 }
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -93,7 +94,19 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the ops of the function in topological order.
+        ///
+        /// The order is cached and only recomputed after the topology of the graph has changed,
+        /// as tracked by Node::get_topology_epoch, or after the parameters or the topological
+        /// sort of the function have been replaced.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
+        /// \brief Returns a value that changes whenever the result of get_ordered_ops may
+        ///        change. Passes can keep it alongside anything they derive from the order
+        ///        and skip recomputing while it stays the same.
+        ///
+        /// The value is global rather than per function: an edit to any graph moves it, which
+        /// conservatively invalidates what every function derived from its order.
+        uint64_t get_topology_epoch() const { return Node::get_topology_epoch(); }
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
         friend std::ostream& operator<<(std::ostream&, const Function&);
@@ -144,5 +157,11 @@ namespace ngraph
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
+
+        // Weak so that the cache does not keep replaced nodes, and their edges, alive
+        mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
+        mutable uint64_t m_cached_ordered_ops_epoch{0};
+        mutable bool m_cached_ordered_ops_valid{false};
+        mutable std::mutex m_cached_ordered_ops_mutex;
     };
 }
@@ -35,6 +35,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<uint64_t> Node::s_topology_epoch(0);
 
 Node::Node(size_t output_size)
     : Node()
@@ -546,11 +547,22 @@ const std::vector<Node*>& Node::get_control_dependents() const
     return m_control_dependents;
 }
 
+uint64_t Node::get_topology_epoch()
+{
+    return s_topology_epoch.load(memory_order_acquire);
+}
+
+void Node::topology_changed()
+{
+    s_topology_epoch.fetch_add(1, memory_order_acq_rel);
+}
+
 void Node::add_control_dependency(std::shared_ptr<Node> node)
 {
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        topology_changed();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -588,6 +600,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
         {
+            topology_changed();
             m_control_dependencies.erase(it);
         }
     }
@@ -602,6 +615,10 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
 
 void Node::clear_control_dependencies()
 {
+    if (!m_control_dependencies.empty())
+    {
+        topology_changed();
+    }
     for (auto& node : m_control_dependencies)
     {
         auto it = find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this);
@@ -147,6 +147,10 @@ namespace ngraph
         // For access to m_outputs.
         friend class descriptor::Input;
 
+        // For access to topology_changed.
+        friend class descriptor::Output;
+        friend class Function;
+
         // For access to m_inputs and m_outputs.
         template <typename NodeType>
         friend class Input;
@@ -355,6 +359,14 @@ namespace ngraph
         /// This node's control dependencies are replaced by replacement
         void transfer_control_dependents(std::shared_ptr<Node> replacement);
 
+        /// \brief Returns a counter that advances whenever a data edge or control dependency
+        ///        between any two nodes is added or removed.
+        ///
+        /// If the counter has not moved, no graph has changed shape since it was read, so
+        /// orderings and other results derived from the edges are still valid. There is one
+        /// counter for the whole process, so it also moves for edits to unrelated graphs.
+        static uint64_t get_topology_epoch();
+
         /// Returns the number of outputs from the node.
         size_t get_output_size() const;
 
@@ -584,6 +596,8 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<uint64_t> s_topology_epoch;
+        static void topology_changed();
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
         std::deque<descriptor::Input> m_inputs;
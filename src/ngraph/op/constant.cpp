@@ -316,9 +316,30 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    NGRAPH_CHECK(m_data != nullptr &&
+                     m_data->size() >= ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f),
+                 "Constant buffer of ",
+                 (m_data ? m_data->size() : 0),
+                 " bytes is too small for shape ",
+                 m_shape,
+                 " of ",
+                 m_element_type);
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::Constant::Constant(const Constant& other)
-    : Constant(other.m_element_type, other.m_shape)
+    : m_element_type(other.m_element_type)
+    , m_shape(other.m_shape)
 {
+    // Copies share the data rather than allocating a buffer that would be dropped at once
     m_data = other.m_data;
     m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
     constructor_validate_and_infer_types();
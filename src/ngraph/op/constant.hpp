@@ -233,6 +233,16 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant over an existing buffer without copying
+                ///        it, for instance a runtime::SharedBuffer over a memory mapped file.
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer holding at least shape_size(shape) elements of type.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
@@ -14,7 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "constant_folding.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -60,3 +67,246 @@ void ngraph::pass::ConstantFolding::construct_constant_default()
                 },
                 PassProperty::CHANGE_DYNAMIC_STATE);
 }
+
+pass::ConstantFolding::CostModel::CostModel()
+    : max_expansion_ratio(std::max(0, getenv_int("NGRAPH_CONSTANT_FOLDING_MAX_EXPANSION", 0)))
+    , min_checked_bytes(64 * 1024)
+    , memory_budget(static_cast<size_t>(
+                        std::max(0, getenv_int("NGRAPH_CONSTANT_FOLDING_BUDGET_MB", 0)))
+                    << 20)
+{
+}
+
+pass::ConstantFolding::ConstantFolding(const ConstantFolding* owner)
+    : GraphRewrite()
+    , m_cfmap(owner->m_cfmap)
+    , m_cost_model(owner->m_cost_model)
+    , m_parallel(false)
+{
+    m_enable_shape_inference = true;
+    construct_matchers();
+    limit_handlers(owner);
+}
+
+// Bytes taken by the outputs of node, or 0 if any of them is not static
+static size_t get_output_bytes(const Node& node)
+{
+    size_t bytes = 0;
+    for (size_t i = 0; i < node.get_output_size(); ++i)
+    {
+        const PartialShape& shape = node.get_output_partial_shape(i);
+        const element::Type& type = node.get_output_element_type(i);
+        if (shape.is_dynamic() || type.is_dynamic())
+        {
+            return 0;
+        }
+        bytes += shape_size(shape.to_shape()) * type.size();
+    }
+    return bytes;
+}
+
+bool pass::ConstantFolding::reserve_fold(const Node& node) const
+{
+    if (m_cost_model.max_expansion_ratio <= 0 && m_cost_model.memory_budget == 0)
+    {
+        return true;
+    }
+    size_t output_bytes = get_output_bytes(node);
+    if (m_cost_model.max_expansion_ratio > 0 && output_bytes > m_cost_model.min_checked_bytes)
+    {
+        size_t input_bytes = 0;
+        for (size_t i = 0; i < node.get_input_size(); ++i)
+        {
+            Node* input_node = node.get_input_node_ptr(i);
+            if (input_node->is_constant())
+            {
+                input_bytes += get_output_bytes(*input_node);
+            }
+        }
+        if (output_bytes > m_cost_model.max_expansion_ratio * input_bytes)
+        {
+            NGRAPH_DEBUG << "Not folding " << node.get_name() << ": " << output_bytes
+                         << " bytes of output from " << input_bytes << " bytes of constants";
+            return false;
+        }
+    }
+    if (m_cost_model.memory_budget > 0)
+    {
+        // Parallel workers share the budget, so the bytes are claimed before folding
+        size_t folded_bytes = m_folded_bytes.load();
+        do
+        {
+            if (folded_bytes + output_bytes > m_cost_model.memory_budget)
+            {
+                NGRAPH_DEBUG << "Not folding " << node.get_name() << ": " << output_bytes
+                             << " bytes would exceed the constant folding budget";
+                return false;
+            }
+        } while (!m_folded_bytes.compare_exchange_weak(folded_bytes, folded_bytes + output_bytes));
+    }
+    return true;
+}
+
+void pass::ConstantFolding::release_fold(const Node& node) const
+{
+    if (m_cost_model.memory_budget > 0)
+    {
+        m_folded_bytes -= get_output_bytes(node);
+    }
+}
+
+void pass::ConstantFolding::limit_handlers(const ConstantFolding* owner)
+{
+    for (MatchClosure& closure : m_matchers)
+    {
+        auto handler = closure.handler;
+        closure.handler = [owner, handler](const shared_ptr<Node>& node) {
+            if (!owner->reserve_fold(*node))
+            {
+                return false;
+            }
+            if (!handler(node))
+            {
+                owner->release_fold(*node);
+                return false;
+            }
+            return true;
+        };
+    }
+}
+
+OutputVector pass::ConstantFolding::fold_isolated(const shared_ptr<Node>& node)
+{
+    // Fold a copy of node reading from copies of its constant inputs, which share their data,
+    // so nothing reachable from other threads is modified. The results stand in for the users
+    // of the copy and end up holding the folded values.
+    OutputVector inputs;
+    for (const Output<Node>& input_value : node->input_values())
+    {
+        auto constant = as_type_ptr<op::Constant>(input_value.get_node_shared_ptr());
+        inputs.push_back(make_shared<op::Constant>(*constant));
+    }
+    shared_ptr<Node> copy = node->copy_with_new_inputs(inputs, {});
+    ResultVector results;
+    for (const Output<Node>& output : copy->outputs())
+    {
+        results.push_back(make_shared<op::Result>(output));
+    }
+
+    for (const MatchClosure& closure : m_matchers)
+    {
+        if (!closure.root_types.empty() &&
+            find(closure.root_types.begin(), closure.root_types.end(), copy->get_type_info()) ==
+                closure.root_types.end())
+        {
+            continue;
+        }
+        if (closure.handler(copy))
+        {
+            OutputVector folded;
+            for (const shared_ptr<op::Result>& result : results)
+            {
+                Output<Node> value = result->input_value(0);
+                if (!value.get_node()->is_constant())
+                {
+                    // Discarded, so the bytes reserved by the handler go back to the budget
+                    release_fold(*copy);
+                    return OutputVector{};
+                }
+                folded.push_back(value);
+            }
+            return folded;
+        }
+    }
+    return OutputVector{};
+}
+
+static bool has_only_constant_inputs(const shared_ptr<Node>& node)
+{
+    if (node->is_constant() || node->is_parameter() || node->is_output() ||
+        node->get_input_size() == 0)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node->get_input_size(); ++i)
+    {
+        if (!node->get_input_node_ptr(i)->is_constant())
+        {
+            return false;
+        }
+    }
+    for (const Output<Node>& output : node->outputs())
+    {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool pass::ConstantFolding::fold_in_parallel(const shared_ptr<Function>& f)
+{
+    bool rewritten = false;
+    // Ops whose fold was refused or failed, not offered again
+    unordered_set<shared_ptr<Node>> unfoldable;
+    while (true)
+    {
+        // Ops whose inputs are all constants do not depend on each other
+        NodeVector candidates;
+        for (const shared_ptr<Node>& node : f->get_ordered_ops())
+        {
+            if (has_only_constant_inputs(node) && unfoldable.count(node) == 0)
+            {
+                candidates.push_back(node);
+            }
+        }
+        if (candidates.size() < 2)
+        {
+            // Nothing to gain over the regular matching
+            break;
+        }
+
+        vector<OutputVector> folded(candidates.size());
+        runtime::parallel_for(candidates.size(), 1, [&](size_t begin, size_t end) {
+            // Matchers keep per-match state, so each range folds with its own copies
+            ConstantFolding worker(this);
+            for (size_t i = begin; i < end; ++i)
+            {
+                folded[i] = worker.fold_isolated(candidates[i]);
+            }
+        });
+
+        bool progress = false;
+        for (size_t i = 0; i < candidates.size(); ++i)
+        {
+            if (folded[i].empty())
+            {
+                unfoldable.insert(candidates[i]);
+            }
+            else
+            {
+                replace_node(candidates[i], folded[i]);
+                progress = true;
+            }
+        }
+        if (!progress)
+        {
+            break;
+        }
+        rewritten = true;
+    }
+    return rewritten;
+}
+
+bool pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    m_folded_bytes = 0;
+    bool rewritten = m_parallel && fold_in_parallel(f);
+    // Everything else, including patterns that span non-constant ops
+    if (GraphRewrite::run_on_function(f))
+    {
+        rewritten = true;
+    }
+    return rewritten;
+}
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <atomic>
+
+#include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
@@ -67,12 +70,50 @@ public:
         NON_ZERO
     };
 
-    ConstantFolding(const ngraph::BuildNodeExecutorMap& cfmap = ngraph::BuildNodeExecutorMap())
+    /// \brief Limits on the constants the pass is allowed to materialize. A fold that would
+    ///        exceed them is refused and the op stays in the graph to be computed at run time.
+    struct NGRAPH_API CostModel
+    {
+        /// Defaults from NGRAPH_CONSTANT_FOLDING_MAX_EXPANSION and
+        /// NGRAPH_CONSTANT_FOLDING_BUDGET_MB, no limits if unset.
+        CostModel();
+
+        /// Refuse a fold whose outputs take more than this many times the bytes of its
+        /// constant inputs, as for a Broadcast, Tile or OneHot of a small constant; 0 for no
+        /// limit.
+        double max_expansion_ratio;
+        /// Folds whose outputs take at most this many bytes are never refused by the
+        /// expansion ratio.
+        size_t min_checked_bytes;
+        /// Total bytes of constants a single run of the pass may create; 0 for no limit.
+        size_t memory_budget;
+    };
+
+    ConstantFolding(const ngraph::BuildNodeExecutorMap& cfmap = ngraph::BuildNodeExecutorMap(),
+                    const CostModel& cost_model = CostModel())
         : GraphRewrite()
+        , m_cfmap(cfmap)
+        , m_cost_model(cost_model)
+        , m_parallel(getenv_bool("NGRAPH_CONSTANT_FOLDING_PARALLEL", true))
     {
-        m_cfmap = cfmap;
         m_enable_shape_inference = true;
+        construct_matchers();
+        limit_handlers(this);
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
+    /// \brief Selects whether ops whose inputs are all constants are folded on the kernel
+    ///        thread pool, one dependency level at a time, before the regular matching.
+    ///        Defaults to NGRAPH_CONSTANT_FOLDING_PARALLEL, on if unset.
+    void set_parallel(bool parallel) { m_parallel = parallel; }
+
+private:
+    /// Copy of owner used to fold ops on a worker thread, with its own matchers
+    explicit ConstantFolding(const ConstantFolding* owner);
+
+    void construct_matchers()
+    {
         construct_constant_split();
         construct_constant_variadic_split();
         construct_constant_broadcast();
@@ -97,7 +138,15 @@ public:
         construct_constant_default();
     }
 
-private:
+    /// Makes every registered handler refuse folds that owner's cost model rejects
+    void limit_handlers(const ConstantFolding* owner);
+    /// Checks node against the cost model and claims its output bytes from the budget
+    bool reserve_fold(const Node& node) const;
+    /// Returns the bytes claimed by reserve_fold for a fold that did not happen
+    void release_fold(const Node& node) const;
+    bool fold_in_parallel(const std::shared_ptr<Function>& f);
+    OutputVector fold_isolated(const std::shared_ptr<Node>& node);
+
     void construct_constant_broadcast();
     void construct_constant_dyn_broadcast();
     void construct_constant_pad();
@@ -122,4 +171,8 @@ private:
     void construct_constant_default();
 
     ngraph::BuildNodeExecutorMap m_cfmap;
+    CostModel m_cost_model;
+    bool m_parallel;
+    // Bytes of constants created by the current run, shared by its worker copies
+    mutable std::atomic<size_t> m_folded_bytes{0};
 };
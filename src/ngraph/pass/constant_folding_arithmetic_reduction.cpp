@@ -266,5 +266,14 @@ void pass::ConstantFolding::construct_constant_arithmetic_reduction()
         make_shared<pattern::Matcher>(reduction, "ConstantFolding.ConstantArithmeticReduction");
     this->add_matcher(arithmetic_reduction_matcher,
                       constant_arithmetic_reduction_callback,
-                      PassProperty::CHANGE_DYNAMIC_STATE);
+                      PassProperty::CHANGE_DYNAMIC_STATE,
+                      {op::Max::type_info,
+                       op::Min::type_info,
+                       op::Product::type_info,
+                       op::Sum::type_info,
+                       op::v1::ReduceMax::type_info,
+                       op::v1::ReduceMin::type_info,
+                       op::v1::ReduceProd::type_info,
+                       op::v1::ReduceSum::type_info,
+                       op::v1::ReduceMean::type_info});
 }
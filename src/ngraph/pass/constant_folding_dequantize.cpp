@@ -94,6 +94,8 @@ void pass::ConstantFolding::construct_constant_dequantize()
 
     auto dequantize_matcher =
         make_shared<pattern::Matcher>(dequant, "ConstantFolding.ConstantDequantize");
-    this->add_matcher(
-        dequantize_matcher, constant_dequantize_callback, PassProperty::CHANGE_DYNAMIC_STATE);
+    this->add_matcher(dequantize_matcher,
+                      constant_dequantize_callback,
+                      PassProperty::CHANGE_DYNAMIC_STATE,
+                      {op::Dequantize::type_info});
 }
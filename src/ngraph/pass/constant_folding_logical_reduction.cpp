@@ -134,5 +134,9 @@ void pass::ConstantFolding::construct_constant_logical_reduction()
         make_shared<pattern::Matcher>(reduction, "ConstantFolding.ConstantLogicalReduction");
     this->add_matcher(logical_reduction_matcher,
                       constant_logical_reduction_callback,
-                      PassProperty::CHANGE_DYNAMIC_STATE);
+                      PassProperty::CHANGE_DYNAMIC_STATE,
+                      {::ngraph::op::All::type_info,
+                       ::ngraph::op::Any::type_info,
+                       ::ngraph::op::v1::ReduceLogicalAnd::type_info,
+                       ::ngraph::op::v1::ReduceLogicalOr::type_info});
 }
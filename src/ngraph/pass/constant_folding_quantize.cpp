@@ -97,6 +97,8 @@ void pass::ConstantFolding::construct_constant_quantize()
 
     auto quantize_matcher =
         make_shared<pattern::Matcher>(quant, "ConstantFolding.ConstantQuantize");
-    this->add_matcher(
-        quantize_matcher, constant_quantize_callback, PassProperty::CHANGE_DYNAMIC_STATE);
+    this->add_matcher(quantize_matcher,
+                      constant_quantize_callback,
+                      PassProperty::CHANGE_DYNAMIC_STATE,
+                      {op::Quantize::type_info});
 }
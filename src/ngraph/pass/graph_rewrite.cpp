@@ -15,14 +15,17 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
 #include <regex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -61,6 +64,73 @@ using namespace ngraph;
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
 
+// Every matcher is keyed on the type(s) of node it can match at its root: the type of the
+// pattern's root op, or the types given to add_matcher when the root is a pattern op such as
+// a Label. A node is only offered to the matchers keyed on its type and to the untyped ones,
+// still in registration order, so the cost per node does not grow with the number of matchers
+// for other op types.
+//
+// With set_use_worklist(true) a round does not stop at the initial topological order. After a
+// successful rewrite the producers now feeding the root node and its former users are queued
+// ahead of the remaining nodes, followed by the root node and the users themselves, so that a
+// rewrite that enables another one is picked up without a second round. Nodes left without
+// users are dropped from the worklist.
+
+pass::GraphRewrite::GraphRewrite()
+    : GraphRewriteBase()
+{
+    static bool s_use_worklist = getenv_bool("NGRAPH_GRAPH_REWRITE_WORKLIST");
+    m_use_worklist = s_use_worklist;
+}
+
+bool pass::GraphRewrite::run_matchers(const shared_ptr<Node>& node,
+                                      const vector<MatchClosure>& matchers,
+                                      const vector<size_t>& candidates,
+                                      const shared_ptr<Function>& f,
+                                      bool& is_dyn_func)
+{
+    static bool s_rerun_dynamic_check = getenv_bool("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK");
+    for (size_t index : candidates)
+    {
+        const MatchClosure& closure = matchers[index];
+        if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+        {
+            NGRAPH_DEBUG << "matcher callback requires static shape but the "
+                            "function is dynamic, skipping this "
+                            "optimization till the shapes are fully "
+                            "materialized";
+            continue;
+        }
+        if (closure.handler(node))
+        {
+            // If call back may change function's is_dynamic state, we need to
+            // update the cached value.
+            if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
+            {
+                is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_live(const shared_ptr<Node>& node)
+{
+    if (node->is_output())
+    {
+        return true;
+    }
+    for (const Output<Node>& output : node->outputs())
+    {
+        if (!output.get_target_inputs().empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     bool rewritten = false;
@@ -78,36 +148,107 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
+
+        // Indices into matchers_to_run for each root type, in registration order
+        vector<size_t> untyped_matchers;
+        unordered_map<NodeTypeInfo, vector<size_t>> typed_matchers;
+        for (size_t i = 0; i < matchers_to_run.size(); ++i)
+        {
+            const vector<NodeTypeInfo>& root_types = matchers_to_run[i].root_types;
+            if (root_types.empty())
+            {
+                untyped_matchers.push_back(i);
+                for (auto& entry : typed_matchers)
+                {
+                    entry.second.push_back(i);
+                }
+            }
+            for (const NodeTypeInfo& type : root_types)
+            {
+                auto it = typed_matchers.find(type);
+                if (it == typed_matchers.end())
+                {
+                    it = typed_matchers.emplace(type, untyped_matchers).first;
+                }
+                if (it->second.empty() || it->second.back() != i)
+                {
+                    it->second.push_back(i);
+                }
+            }
+        }
+        auto candidates_for = [&](const Node& node) -> const vector<size_t>& {
+            auto it = typed_matchers.find(node.get_type_info());
+            return it == typed_matchers.end() ? untyped_matchers : it->second;
+        };
+
+        if (!m_use_worklist)
+        {
+            for (auto node : f->get_ordered_ops())
+            {
+                if (m_enable_shape_inference)
+                {
+                    node->revalidate_and_infer_types();
+                }
+                if (run_matchers(node, matchers_to_run, candidates_for(*node), f, is_dyn_func))
+                {
+                    rewritten = true;
+                }
+            }
+            continue;
+        }
+
+        deque<shared_ptr<Node>> worklist;
+        unordered_set<Node*> queued;
         for (auto node : f->get_ordered_ops())
         {
+            worklist.push_back(node);
+            queued.insert(node.get());
+        }
+        // Bounds the revisits a matcher that keeps reporting success can cause
+        size_t visits_left = NUM_TRIES * worklist.size();
+        while (!worklist.empty() && visits_left-- > 0)
+        {
+            shared_ptr<Node> node = worklist.front();
+            worklist.pop_front();
+            queued.erase(node.get());
+            if (!is_live(node))
+            {
+                continue;
+            }
             if (m_enable_shape_inference)
             {
                 node->revalidate_and_infer_types();
             }
-            for (auto& closure : matchers_to_run)
+            NodeVector users = node->get_users();
+            if (!run_matchers(node, matchers_to_run, candidates_for(*node), f, is_dyn_func))
             {
-                if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+                continue;
+            }
+            rewritten = true;
+
+            // Queue front-first so producers come before the nodes they feed
+            NodeVector revisit;
+            for (const Output<Node>& input_value : node->input_values())
+            {
+                revisit.push_back(input_value.get_node_shared_ptr());
+            }
+            for (const shared_ptr<Node>& user : users)
+            {
+                for (const Output<Node>& input_value : user->input_values())
                 {
-                    NGRAPH_DEBUG << "matcher callback requires static shape but the "
-                                    "function is dynamic, skipping this "
-                                    "optimization till the shapes are fully "
-                                    "materialized";
-                    continue;
+                    revisit.push_back(input_value.get_node_shared_ptr());
                 }
-                if (closure.handler(node))
+            }
+            revisit.push_back(node);
+            revisit.insert(revisit.end(), users.begin(), users.end());
+            for (auto it = revisit.rbegin(); it != revisit.rend(); ++it)
+            {
+                if (queued.insert(it->get()).second)
                 {
-                    rewritten = true;
-                    // If call back may change function's is_dynamic state, we need to
-                    // update the cached value.
-                    if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
-                    {
-                        is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
-                    }
-                    break;
+                    worklist.push_front(*it);
                 }
             }
         }
-
     } while (rewritten && m_matchers.size() > 0 && tries--);
 
     m_matchers.assign(original_matchers.begin(), original_matchers.end());
@@ -150,10 +291,18 @@ bool pass::GraphRewriteBase::is_enabled(const std::string& name) const
 void pass::GraphRewriteBase::add_handler(const std::string& name,
                                          function<bool(const std::shared_ptr<Node>&)> handler,
                                          const PassPropertyMask& property)
+{
+    add_handler(name, handler, property, {});
+}
+
+void pass::GraphRewriteBase::add_handler(const std::string& name,
+                                         function<bool(const std::shared_ptr<Node>&)> handler,
+                                         const PassPropertyMask& property,
+                                         const vector<NodeTypeInfo>& root_types)
 {
     if (is_enabled(name))
     {
-        m_matchers.push_back({name, handler, property});
+        m_matchers.push_back({name, handler, property, root_types});
         // If any matcher call back may change dynamic state, we need to
         // update the pass property.
         if (property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -166,6 +315,21 @@ void pass::GraphRewriteBase::add_handler(const std::string& name,
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                                      const graph_rewrite_callback& callback,
                                      const PassPropertyMask& property)
+{
+    // A regular op at the root of the pattern only matches nodes of its own type
+    vector<NodeTypeInfo> root_types;
+    shared_ptr<Node> root = m->get_pattern_value().get_node_shared_ptr();
+    if (!dynamic_pointer_cast<pattern::op::Pattern>(root))
+    {
+        root_types.push_back(root->get_type_info());
+    }
+    add_matcher(m, callback, property, root_types);
+}
+
+void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
+                                     const graph_rewrite_callback& callback,
+                                     const PassPropertyMask& property,
+                                     const vector<NodeTypeInfo>& root_types)
 {
     add_handler(m->get_name(),
                 [m, callback](const std::shared_ptr<Node>& node) -> bool {
@@ -177,7 +341,8 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                     }
                     return false;
                 },
-                property);
+                property,
+                root_types);
 }
 
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
@@ -19,6 +19,7 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -48,6 +49,16 @@ public:
                      std::function<bool(const std::shared_ptr<Node>& node)> handler,
                      const PassPropertyMask& property);
 
+    /// \brief Add a handler that can only apply to nodes of the given types
+    /// \param name The name of the handler
+    /// \param handler Function responsible for deciding if the graph should be changed and making
+    /// the changes. Returns true if changes are made.
+    /// \param root_types The handler is only offered nodes of these types; all nodes if empty
+    void add_handler(const std::string& name,
+                     std::function<bool(const std::shared_ptr<Node>& node)> handler,
+                     const PassPropertyMask& property,
+                     const std::vector<NodeTypeInfo>& root_types);
+
 protected:
     GraphRewriteBase()
         : FunctionPass()
@@ -65,6 +76,8 @@ protected:
         std::string name;
         std::function<bool(const std::shared_ptr<Node>& node)> handler;
         PassPropertyMask property;
+        // Empty when the handler may apply to any node
+        std::vector<NodeTypeInfo> root_types;
     };
     std::vector<MatchClosure> m_matchers;
 };
@@ -82,18 +95,47 @@ protected:
 class NGRAPH_API ngraph::pass::GraphRewrite : public ngraph::pass::GraphRewriteBase
 {
 public:
+    GraphRewrite();
+
     void add_matcher(const std::shared_ptr<pattern::Matcher>& m,
                      const ngraph::graph_rewrite_callback& callback,
                      const PassPropertyMask& property);
 
+    /// \brief Add a matcher whose pattern root is a pattern op, such as a Label with a
+    ///        predicate, but which can only match nodes of the given types.
+    ///
+    /// Matchers rooted at a regular op are only ever offered nodes of that op's type; this
+    /// extends the same dispatch to matchers whose root type cannot be read off the pattern.
+    void add_matcher(const std::shared_ptr<pattern::Matcher>& m,
+                     const ngraph::graph_rewrite_callback& callback,
+                     const PassPropertyMask& property,
+                     const std::vector<NodeTypeInfo>& root_types);
+
     // TODO: This interface may deprecate after all passes are refactored.
     void add_matcher(const std::shared_ptr<pattern::Matcher>& m,
                      const ngraph::graph_rewrite_callback& callback);
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Selects how nodes are revisited within a round of matching.
+    ///
+    /// By default each round offers every node of the function to the matchers once, in
+    /// topological order. With the worklist enabled, a successful rewrite also queues the
+    /// nodes around it - the users of the rewritten node and whatever now feeds them - so
+    /// rewrites that enable further rewrites cascade within the same round. Also enabled for
+    /// every GraphRewrite by NGRAPH_GRAPH_REWRITE_WORKLIST.
+    void set_use_worklist(bool use_worklist) { m_use_worklist = use_worklist; }
+
 protected:
     bool m_enable_shape_inference = false;
+    bool m_use_worklist;
+
+private:
+    bool run_matchers(const std::shared_ptr<Node>& node,
+                      const std::vector<MatchClosure>& matchers,
+                      const std::vector<size_t>& candidates,
+                      const std::shared_ptr<Function>& f,
+                      bool& is_dyn_func);
 };
 
 class NGRAPH_API ngraph::pass::RecurrentGraphRewrite : public ngraph::pass::GraphRewriteBase
@@ -14,10 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <numeric>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
-#include "ngraph/log.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -30,9 +34,10 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing, Planner planner)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_planner(planner)
 {
     if (m_alignment == 0)
     {
@@ -40,54 +45,106 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
     }
 }
 
+pass::MemoryLayout::Planner pass::MemoryLayout::get_default_planner()
+{
+    static Planner s_planner = []() {
+        string planner = to_lower(getenv_string("NGRAPH_MEMORY_PLANNER"));
+        if (planner == "greedy_by_size")
+        {
+            return Planner::GREEDY_BY_SIZE;
+        }
+        if (!planner.empty() && planner != "op_order")
+        {
+            throw ngraph_error("Unknown NGRAPH_MEMORY_PLANNER '" + planner + "'");
+        }
+        return Planner::OP_ORDER;
+    }();
+    return s_planner;
+}
+
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
-    for (shared_ptr<Node> node : function->get_ordered_ops())
-    {
-        std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
-        std::set<const descriptor::Tensor*> reused_inputs;
+    // Without sharing nothing is ever freed, so there is nothing to plan globally
+    size_t pool_size = (m_planner == Planner::GREEDY_BY_SIZE && !m_disable_memory_sharing)
+                           ? plan_greedy_by_size(function)
+                           : plan_op_order(function);
+    function->set_temporary_pool_size(pool_size);
+    m_allocated_bytes = pool_size;
+    NGRAPH_DEBUG << "Planned " << pool_size << " bytes of temporaries for " << m_peak_live_bytes
+                 << " peak live bytes in " << function->get_name();
+    return false;
+}
 
-        if (node->is_op())
+// Finds the outputs of node that can take over the memory of one of its inputs
+static void get_in_place_outputs(const shared_ptr<Node>& node,
+                                 bool disable_memory_sharing,
+                                 map<descriptor::Tensor*, descriptor::Tensor*>& in_place_outputs,
+                                 set<const descriptor::Tensor*>& reused_inputs)
+{
+    if (node->is_op())
+    {
+        auto op = std::static_pointer_cast<op::Op>(node);
+        // concat and slice in_place_oi should be treated differently
+        if (!is_type<op::Concat>(node) && !is_type<op::Slice>(node))
         {
-            auto op = std::static_pointer_cast<op::Op>(node);
-            // concat and slice in_place_oi should be treated differently
-            if (!is_type<op::Concat>(node) && !is_type<op::Slice>(node))
+            if (auto op_annotations = op->get_op_annotations())
             {
-                if (auto op_annotations = op->get_op_annotations())
+                for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
                 {
-                    for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+                    auto output = &node->output(oi_pair.output).get_tensor();
+                    auto input = &node->get_input_tensor(oi_pair.input);
+                    auto input_node = node->get_input_node_ptr(oi_pair.input);
+
+                    // For destructive kernel, this should be the last use
+                    // Non-destructive kernels can pass through if memory sharing is disabled
+                    if ((node->liveness_free_list.count(input) != 0 ||
+                         is_type<op::GetOutputElement>(node) ||
+                         (disable_memory_sharing && !oi_pair.destructive &&
+                          !input_node->is_parameter() && !input_node->is_constant())) &&
+                        node->liveness_new_list.count(output) != 0)
+
                     {
-                        auto output = &node->output(oi_pair.output).get_tensor();
-                        auto input = &node->get_input_tensor(oi_pair.input);
-                        auto input_node = node->get_input_node_ptr(oi_pair.input);
-
-                        // For destructive kernel, this should be the last use
-                        // Non-destructive kernels can pass through if memory sharing is disabled
-                        if ((node->liveness_free_list.count(input) != 0 ||
-                             is_type<op::GetOutputElement>(node) ||
-                             (m_disable_memory_sharing && !oi_pair.destructive &&
-                              !input_node->is_parameter() && !input_node->is_constant())) &&
-                            node->liveness_new_list.count(output) != 0)
-
-                        {
-                            NGRAPH_DEBUG << "Reusing " << input->get_name() << " for "
-                                         << output->get_name();
-                            in_place_outputs.insert({output, input});
-                            reused_inputs.insert(input);
-                        }
+                        NGRAPH_DEBUG << "Reusing " << input->get_name() << " for "
+                                     << output->get_name();
+                        in_place_outputs.insert({output, input});
+                        reused_inputs.insert(input);
                     }
                 }
             }
         }
+    }
+}
+
+size_t pass::MemoryLayout::plan_op_order(const shared_ptr<Function>& function)
+{
+    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // Aligned size of each allocation by offset, to track the live total
+    unordered_map<size_t, size_t> live_allocations;
+    size_t live_bytes = 0;
+    m_peak_live_bytes = 0;
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+        std::set<const descriptor::Tensor*> reused_inputs;
+        get_in_place_outputs(node, m_disable_memory_sharing, in_place_outputs, reused_inputs);
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = in_place_outputs.count(tensor)
-                                ? in_place_outputs.at(tensor)->get_pool_offset()
-                                : mm.allocate(tensor->size());
+            size_t offset;
+            if (in_place_outputs.count(tensor))
+            {
+                offset = in_place_outputs.at(tensor)->get_pool_offset();
+            }
+            else
+            {
+                offset = mm.allocate(tensor->size());
+                size_t size = MemoryManager::align(tensor->size(), m_alignment);
+                live_allocations[offset] = size;
+                live_bytes += size;
+            }
             tensor->set_pool_offset(offset);
         }
+        m_peak_live_bytes = std::max(m_peak_live_bytes, live_bytes);
 
         if (!m_disable_memory_sharing)
         {
@@ -96,13 +153,148 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
                 if (reused_inputs.count(tensor) == 0)
                 {
                     mm.free(tensor->get_pool_offset());
+                    auto it = live_allocations.find(tensor->get_pool_offset());
+                    if (it != live_allocations.end())
+                    {
+                        live_bytes -= it->second;
+                        live_allocations.erase(it);
+                    }
                 }
             }
         }
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+    return mm.max_allocated();
+}
 
-    return false;
+// Greedy-by-size placement over the liveness intervals of the whole function. A tensor that
+// takes over the memory of an input joins the block of that input, so blocks rather than
+// tensors are placed. Blocks are placed largest first, each in the smallest gap between the
+// blocks already placed that are live at the same time, or above all of them if no gap fits.
+size_t pass::MemoryLayout::plan_greedy_by_size(const shared_ptr<Function>& function)
+{
+    struct Block
+    {
+        size_t size;
+        size_t begin;
+        size_t end;
+        size_t offset;
+        vector<descriptor::Tensor*> tensors;
+    };
+    vector<Block> blocks;
+    unordered_map<const descriptor::Tensor*, size_t> block_of;
+    unordered_set<const descriptor::Tensor*> freed;
+
+    size_t step = 0;
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+        std::set<const descriptor::Tensor*> reused_inputs;
+        get_in_place_outputs(node, false, in_place_outputs, reused_inputs);
+
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            size_t size = MemoryManager::align(tensor->size(), m_alignment);
+            auto in_place = in_place_outputs.find(tensor);
+            size_t index;
+            if (in_place != in_place_outputs.end() && block_of.count(in_place->second))
+            {
+                index = block_of.at(in_place->second);
+                blocks[index].size = std::max(blocks[index].size, size);
+            }
+            else
+            {
+                index = blocks.size();
+                blocks.push_back(Block{size, step, step, 0, {}});
+            }
+            blocks[index].tensors.push_back(tensor);
+            block_of[tensor] = index;
+        }
+        for (const descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            auto it = block_of.find(tensor);
+            if (it != block_of.end())
+            {
+                blocks[it->second].end = std::max(blocks[it->second].end, step);
+                freed.insert(tensor);
+            }
+        }
+        step++;
+    }
+    // Temporaries that are never freed stay live to the end
+    for (Block& block : blocks)
+    {
+        for (const descriptor::Tensor* tensor : block.tensors)
+        {
+            if (freed.count(tensor) == 0)
+            {
+                block.end = step;
+            }
+        }
+    }
+
+    vector<size_t> order(blocks.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&blocks](size_t a, size_t b) {
+        return blocks[a].size > blocks[b].size;
+    });
+
+    size_t pool_size = 0;
+    vector<size_t> placed;
+    vector<pair<size_t, size_t>> in_use;
+    for (size_t index : order)
+    {
+        Block& block = blocks[index];
+        in_use.clear();
+        for (size_t other_index : placed)
+        {
+            const Block& other = blocks[other_index];
+            if (other.begin <= block.end && block.begin <= other.end)
+            {
+                in_use.push_back({other.offset, other.offset + other.size});
+            }
+        }
+        sort(in_use.begin(), in_use.end());
+
+        size_t best_offset = numeric_limits<size_t>::max();
+        size_t best_gap = numeric_limits<size_t>::max();
+        size_t candidate = 0;
+        for (const pair<size_t, size_t>& range : in_use)
+        {
+            if (range.first > candidate)
+            {
+                size_t gap = range.first - candidate;
+                if (gap >= block.size && gap < best_gap)
+                {
+                    best_offset = candidate;
+                    best_gap = gap;
+                }
+            }
+            candidate = std::max(candidate, range.second);
+        }
+        block.offset = best_offset == numeric_limits<size_t>::max() ? candidate : best_offset;
+        pool_size = std::max(pool_size, block.offset + block.size);
+        placed.push_back(index);
+    }
+
+    // Peak of the total size of the blocks live at each step
+    vector<int64_t> delta(step + 2, 0);
+    for (Block& block : blocks)
+    {
+        for (descriptor::Tensor* tensor : block.tensors)
+        {
+            tensor->set_pool_offset(block.offset);
+        }
+        delta[block.begin] += block.size;
+        delta[block.end + 1] -= block.size;
+    }
+    m_peak_live_bytes = 0;
+    int64_t live_bytes = 0;
+    for (int64_t d : delta)
+    {
+        live_bytes += d;
+        m_peak_live_bytes = std::max(m_peak_live_bytes, static_cast<size_t>(live_bytes));
+    }
+    return pool_size;
 }
 
 pass::MemoryManager::node::node(size_t size, block_state state)
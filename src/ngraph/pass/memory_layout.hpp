@@ -35,12 +35,40 @@ namespace ngraph
 class NGRAPH_API ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    /// \brief How offsets in the temporary pool are assigned
+    enum class Planner
+    {
+        /// Allocate and free each tensor with a MemoryManager while visiting the ops in order
+        OP_ORDER,
+        /// Collect the liveness interval of every tensor first, then place the largest ones
+        /// first, each at the lowest offset not in use by any tensor it is live with
+        GREEDY_BY_SIZE
+    };
+
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 Planner planner = get_default_planner());
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
+    /// \brief Largest total size, padding included, of the temporaries live at any one op in
+    ///        the last run. No planner can use less, so comparing it with
+    ///        get_allocated_bytes shows how much the plan loses to fragmentation.
+    size_t get_peak_live_bytes() const { return m_peak_live_bytes; }
+    /// \brief Size of the temporary pool planned in the last run
+    size_t get_allocated_bytes() const { return m_allocated_bytes; }
+    /// \brief The planner named by NGRAPH_MEMORY_PLANNER, "op_order" or "greedy_by_size".
+    ///        OP_ORDER if unset.
+    static Planner get_default_planner();
+
 private:
+    size_t plan_op_order(const std::shared_ptr<Function>& function);
+    size_t plan_greedy_by_size(const std::shared_ptr<Function>& function);
+
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    Planner m_planner;
+    size_t m_peak_live_bytes{0};
+    size_t m_allocated_bytes{0};
 };
 
 class NGRAPH_API ngraph::pass::MemoryManager
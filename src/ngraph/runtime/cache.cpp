@@ -16,12 +16,26 @@
 
 #include "ngraph/runtime/cache.hpp"
 #include "ngraph/env_util.hpp"
+#include "ngraph/op/constant.hpp"
 
 using namespace ngraph;
 using namespace std;
 
+size_t runtime::LRUCache::KeyHash::operator()(const vector<int>& key) const
+{
+    // FNV-1a over the raw key values; keys are short so this is cheaper than building a string
+    size_t hash = 14695981039346656037ULL;
+    for (int value : key)
+    {
+        hash ^= static_cast<size_t>(static_cast<unsigned int>(value));
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
 // Constructor
 runtime::LRUCache::LRUCache()
+    : LRUCache(0, 0)
 {
     int32_t cache_size = getenv_int("NGRAPH_CACHE_SIZE");
     if (cache_size <= 0)
@@ -33,85 +47,135 @@ runtime::LRUCache::LRUCache()
         m_cache_size = cache_size;
     }
 
-    m_map = {};
-    m_list = {};
+    int32_t cache_size_mb = getenv_int("NGRAPH_CACHE_SIZE_MB");
+    if (cache_size_mb > 0)
+    {
+        m_cache_byte_size = static_cast<size_t>(cache_size_mb) << 20;
+    }
+}
+
+runtime::LRUCache::LRUCache(size_t max_entries, size_t max_bytes)
+    : m_cache_size(max_entries)
+    , m_cache_byte_size(max_bytes)
+    , m_byte_count(0)
+    , m_hit_count(0)
+    , m_miss_count(0)
+    , m_eviction_count(0)
+{
 }
 
 // Destructor
 runtime::LRUCache::~LRUCache()
 {
-    m_list.clear();
     m_map.clear();
-    m_clone_function_map.clear();
+    m_list.clear();
 }
 
-void runtime::LRUCache::convert_shape_to_string(const vector<int>& shape, ostringstream& key)
+size_t runtime::LRUCache::estimate_size_in_bytes(const shared_ptr<Function>& func)
 {
-    if (!shape.empty())
+    size_t size = 0;
+    if (func)
     {
-        std::copy(shape.begin(), shape.end(), std::ostream_iterator<int>(key, ", "));
+        for (auto& node : func->get_ops())
+        {
+            if (auto constant = as_type_ptr<op::Constant>(node))
+            {
+                size += shape_size(constant->get_shape()) * constant->get_element_type().size();
+            }
+        }
+        size += func->get_temporary_pool_size();
     }
+    return size;
+}
+
+void runtime::LRUCache::evict_back()
+{
+    Entry& victim = m_list.back();
+    m_byte_count -= victim.m_size_in_bytes;
+    m_map.erase(victim.m_key);
+    // Dropping the entry releases both the executable and its cloned function
+    m_list.pop_back();
+    m_eviction_count++;
 }
 
 void runtime::LRUCache::add_entry(const vector<int>& shape,
                                   shared_ptr<runtime::Executable> exec,
                                   shared_ptr<Function> func)
 {
+    if (m_cache_size == 0)
+    {
+        return;
+    }
+    size_t size_in_bytes = estimate_size_in_bytes(func);
+
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    // check if the list is empty
-    if (m_list.size() == m_cache_size)
+    auto it = m_map.find(shape);
+    if (it != m_map.end())
     {
-        ostringstream key;
-        convert_shape_to_string(m_list.back(), key);
-        m_list.pop_back();
-        m_map.erase(key.str());
+        // Another caller compiled the same shapes concurrently; keep the newest result
+        m_byte_count -= it->second->m_size_in_bytes;
+        m_list.erase(it->second);
+        m_map.erase(it);
     }
 
-    convert_shape_to_string(shape, key);
-    m_map.insert({key.str(), exec});
-    m_list.push_front(shape);
-    m_clone_function_map.insert({key.str(), func});
+    // An entry larger than the whole byte budget is still cached on its own, otherwise every
+    // call with those shapes would recompile
+    while (!m_list.empty() &&
+           (m_list.size() >= m_cache_size ||
+            (m_cache_byte_size != 0 && m_byte_count + size_in_bytes > m_cache_byte_size)))
+    {
+        evict_back();
+    }
+
+    m_list.push_front(Entry{shape, exec, func, size_in_bytes});
+    m_map.insert({shape, m_list.begin()});
+    m_byte_count += size_in_bytes;
 }
 
-bool runtime::LRUCache::is_cached(const vector<int>& shape)
+runtime::LRUCache::EntryList::iterator runtime::LRUCache::find_and_touch(const vector<int>& shape)
 {
-    for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
+    auto it = m_map.find(shape);
+    if (it == m_map.end())
     {
-        if (*itr == shape)
-        {
-            return true;
-        }
+        return m_list.end();
     }
-    return false;
+    // Move the entry to the front without invalidating the iterator held by the map
+    m_list.splice(m_list.begin(), m_list, it->second);
+    return it->second;
 }
 
-shared_ptr<runtime::Executable> runtime::LRUCache::get_cached_entry(const vector<int>& shape)
+bool runtime::LRUCache::is_cached(const vector<int>& shape)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
+    return m_map.find(shape) != m_map.end();
+}
 
-    // find the entry and return the function
-    auto it = m_map.find(key.str());
-    if (it == m_map.end())
+bool runtime::LRUCache::lookup(const vector<int>& shape,
+                               shared_ptr<runtime::Executable>& exec,
+                               shared_ptr<Function>& func)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = find_and_touch(shape);
+    if (it == m_list.end())
     {
-        throw ngraph_error("Entry not found in cache");
+        m_miss_count++;
+        return false;
     }
-    else
+    m_hit_count++;
+    exec = it->m_executable;
+    func = it->m_function;
+    return true;
+}
+
+shared_ptr<runtime::Executable> runtime::LRUCache::get_cached_entry(const vector<int>& shape)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = find_and_touch(shape);
+    if (it == m_list.end())
     {
-        // update list to push this reference to the front
-        for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
-        {
-            if (*itr == shape)
-            {
-                m_list.remove(shape);
-                m_list.push_front(shape);
-                break;
-            }
-        }
-        return it->second;
+        throw ngraph_error("Entry not found in cache");
     }
+    return it->m_executable;
 }
 
 // Need the clone function to get the output shape so that
@@ -119,13 +183,40 @@ shared_ptr<runtime::Executable> runtime::LRUCache::get_cached_entry(const vector
 shared_ptr<Function> runtime::LRUCache::get_cloned_function(const vector<int>& shape)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
-    // find the entry and return the function
-    auto it = m_clone_function_map.find(key.str());
-    if (it == m_clone_function_map.end())
+    auto it = m_map.find(shape);
+    if (it == m_map.end())
     {
         throw ngraph_error("Cloned function not found");
     }
-    return it->second;
+    return it->second->m_function;
+}
+
+size_t runtime::LRUCache::get_hit_count() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_hit_count;
+}
+
+size_t runtime::LRUCache::get_miss_count() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_miss_count;
+}
+
+size_t runtime::LRUCache::get_eviction_count() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_eviction_count;
+}
+
+size_t runtime::LRUCache::get_entry_count() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_list.size();
+}
+
+size_t runtime::LRUCache::get_byte_count() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_byte_count;
 }
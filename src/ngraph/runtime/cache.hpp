@@ -16,14 +16,12 @@
 
 #pragma once
 
-#include <algorithm>
-#include <iostream>
-#include <iterator>
+#include <cstddef>
 #include <list>
+#include <memory>
 #include <mutex>
-#include <sstream>
-#include <string>
 #include <unordered_map>
+#include <vector>
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/executable.hpp"
 #include "ngraph/shape.hpp"
@@ -32,13 +30,25 @@ namespace ngraph
 {
     namespace runtime
     {
-        class LRUCache : public std::enable_shared_from_this<LRUCache>
+        /// \brief Least-recently-used cache of compiled executables keyed on the merged input
+        ///        shapes of a call.
+        ///
+        /// Lookups hash the raw key vector and splice the hit entry to the front of the
+        /// recency list, so every operation is O(1) in the number of cached entries. The cache
+        /// is bounded both by entry count (NGRAPH_CACHE_SIZE) and by the estimated bytes held
+        /// by the cached functions (NGRAPH_CACHE_SIZE_MB, unbounded when unset).
+        class NGRAPH_API LRUCache : public std::enable_shared_from_this<LRUCache>
         {
         public:
-            using GraphCache = std::unordered_map<std::string, std::shared_ptr<Executable>>;
-            using ClonedFunctionMap = std::unordered_map<std::string, std::shared_ptr<Function>>;
+            struct KeyHash
+            {
+                size_t operator()(const std::vector<int>& key) const;
+            };
 
             LRUCache();
+            /// \param max_entries Maximum number of cached executables, 0 disables caching
+            /// \param max_bytes Maximum estimated bytes held by the cache, 0 for no limit
+            LRUCache(size_t max_entries, size_t max_bytes);
 
             virtual ~LRUCache();
 
@@ -47,15 +57,47 @@ namespace ngraph
                            std::shared_ptr<Function> func);
             bool is_cached(const std::vector<int>& shape);
             std::shared_ptr<Executable> get_cached_entry(const std::vector<int>& shape);
-            void convert_shape_to_string(const std::vector<int>& shape, std::ostringstream& key);
             std::shared_ptr<Function> get_cloned_function(const std::vector<int>& shape);
 
+            /// \brief Looks up an entry and marks it most-recently-used in a single step.
+            /// \returns true on a hit, in which case exec and func are filled in
+            bool lookup(const std::vector<int>& shape,
+                        std::shared_ptr<Executable>& exec,
+                        std::shared_ptr<Function>& func);
+
+            size_t get_hit_count() const;
+            size_t get_miss_count() const;
+            size_t get_eviction_count() const;
+            size_t get_entry_count() const;
+            size_t get_byte_count() const;
+            size_t get_max_entries() const { return m_cache_size; }
+            size_t get_max_bytes() const { return m_cache_byte_size; }
+            /// \brief Estimate of the host memory pinned by a cached function: its constant
+            ///        payloads plus its planned temporary pool.
+            static size_t estimate_size_in_bytes(const std::shared_ptr<Function>& func);
+
         private:
-            int m_cache_size;
-            GraphCache m_map;
-            ClonedFunctionMap m_clone_function_map;
-            std::list<std::vector<int>> m_list;
-            std::mutex m_mutex;
+            struct Entry
+            {
+                std::vector<int> m_key;
+                std::shared_ptr<Executable> m_executable;
+                std::shared_ptr<Function> m_function;
+                size_t m_size_in_bytes;
+            };
+            using EntryList = std::list<Entry>;
+
+            EntryList::iterator find_and_touch(const std::vector<int>& shape);
+            void evict_back();
+
+            size_t m_cache_size;
+            size_t m_cache_byte_size;
+            size_t m_byte_count;
+            size_t m_hit_count;
+            size_t m_miss_count;
+            size_t m_eviction_count;
+            EntryList m_list;
+            std::unordered_map<std::vector<int>, EntryList::iterator, KeyHash> m_map;
+            mutable std::mutex m_mutex;
         };
     }
 }
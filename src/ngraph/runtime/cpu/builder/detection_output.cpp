@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/detection_output.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/detection_output.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DetectionOutput)
+            {
+                auto& functors = external_function->get_functors();
+                auto detection = static_cast<const ngraph::op::DetectionOutput*>(node);
+                if (args.size() != 3)
+                {
+                    throw ngraph_error("Unsupported DetectionOutput with auxiliary predictions");
+                }
+                if (args[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       args[0].get_element_type().c_type_string() +
+                                       " for DetectionOutput");
+                }
+
+                auto location_buffer_index =
+                    external_function->get_buffer_index(args[0].get_name());
+                auto confidence_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto priors_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto attrs = detection->get_attrs();
+                auto location_shape = args[0].get_shape();
+                auto priors_shape = args[2].get_shape();
+                auto out_shape = out[0].get_shape();
+
+                auto functor = [&,
+                                attrs,
+                                location_shape,
+                                priors_shape,
+                                out_shape,
+                                location_buffer_index,
+                                confidence_buffer_index,
+                                priors_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    runtime::reference::detection_output<float>(
+                        static_cast<const float*>(ctx->buffer_data[location_buffer_index]),
+                        static_cast<const float*>(ctx->buffer_data[confidence_buffer_index]),
+                        static_cast<const float*>(ctx->buffer_data[priors_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        attrs,
+                        location_shape,
+                        priors_shape,
+                        out_shape,
+                        executor::GetCPUExecutor().get_parallel_for(ectx->arena));
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_detection_output_cpp() { REGISTER_OP_BUILDER(DetectionOutput); }
+        }
+    }
+}
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/embedding_segments_sum.hpp"
+#include "ngraph/runtime/cpu/builder/embedding_sum.hpp"
+#include "ngraph/runtime/reference/embedding_segments_sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            struct EmbeddingSegmentsSumKernel
+            {
+                template <typename T, typename I>
+                static void call(const T* table,
+                                 const Shape& table_shape,
+                                 const I* indices,
+                                 size_t num_indices,
+                                 const I* segment_ids,
+                                 size_t num_segments,
+                                 const I* default_index,
+                                 const T* weights,
+                                 T* out,
+                                 const ParallelFor& parallel)
+                {
+                    reference::embedding_segments_sum(table,
+                                                      table_shape,
+                                                      indices,
+                                                      num_indices,
+                                                      segment_ids,
+                                                      num_segments,
+                                                      default_index,
+                                                      weights,
+                                                      out,
+                                                      parallel);
+                }
+            };
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::EmbeddingSegmentsSum)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+                size_t num_segments = out[0].get_shape().at(0);
+                functors.emplace_back(build_embedding_sum_functor<EmbeddingSegmentsSumKernel>(
+                    external_function, args, out, 4, num_segments, "EmbeddingSegmentsSum"));
+            }
+
+            void register_builders_embedding_segments_sum_cpp()
+            {
+                REGISTER_OP_BUILDER(EmbeddingSegmentsSum);
+            }
+        }
+    }
+}
@@ -0,0 +1,143 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Builds the functor shared by the embedding sum ops.
+            ///
+            /// The ops take (table, indices, segments, ...) and optionally a default index at
+            /// argument \p default_index_arg followed by per-sample weights. \p Kernel provides
+            /// a static `call<T, I>` with the signature of reference::embeddingbag_offsets_sum.
+            template <typename Kernel, typename T, typename I>
+            CPUKernelFunctor prepare_embedding_sum_functor(CPU_ExternalFunction* external_function,
+                                                           const std::vector<TensorWrapper>& args,
+                                                           const std::vector<TensorWrapper>& out,
+                                                           size_t default_index_arg,
+                                                           size_t num_segments)
+            {
+                auto table_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto indices_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto segments_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                bool has_default_index = args.size() > default_index_arg;
+                auto default_index_buffer_index =
+                    has_default_index
+                        ? external_function->get_buffer_index(args[default_index_arg].get_name())
+                        : 0;
+                bool has_weights = args.size() > default_index_arg + 1;
+                auto weights_arg = default_index_arg + 1;
+                auto weights_buffer_index =
+                    has_weights ? external_function->get_buffer_index(args[weights_arg].get_name())
+                                : 0;
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto table_shape = args[0].get_shape();
+                size_t num_indices = shape_size(args[1].get_shape());
+
+                return [table_shape,
+                        num_indices,
+                        num_segments,
+                        has_default_index,
+                        has_weights,
+                        table_buffer_index,
+                        indices_buffer_index,
+                        segments_buffer_index,
+                        default_index_buffer_index,
+                        weights_buffer_index,
+                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    Kernel::template call<T, I>(
+                        static_cast<const T*>(ctx->buffer_data[table_buffer_index]),
+                        table_shape,
+                        static_cast<const I*>(ctx->buffer_data[indices_buffer_index]),
+                        num_indices,
+                        static_cast<const I*>(ctx->buffer_data[segments_buffer_index]),
+                        num_segments,
+                        has_default_index
+                            ? static_cast<const I*>(ctx->buffer_data[default_index_buffer_index])
+                            : nullptr,
+                        has_weights ? static_cast<const T*>(ctx->buffer_data[weights_buffer_index])
+                                    : nullptr,
+                        static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                        executor::GetCPUExecutor().get_parallel_for(ectx->arena));
+                };
+            }
+
+            template <typename Kernel, typename T>
+            CPUKernelFunctor select_embedding_sum_functor(CPU_ExternalFunction* external_function,
+                                                          const std::vector<TensorWrapper>& args,
+                                                          const std::vector<TensorWrapper>& out,
+                                                          size_t default_index_arg,
+                                                          size_t num_segments,
+                                                          const std::string& op_name)
+            {
+                auto index_type = args[1].get_element_type();
+                if (index_type == element::i64)
+                {
+                    return prepare_embedding_sum_functor<Kernel, T, int64_t>(
+                        external_function, args, out, default_index_arg, num_segments);
+                }
+                else if (index_type == element::i32)
+                {
+                    return prepare_embedding_sum_functor<Kernel, T, int32_t>(
+                        external_function, args, out, default_index_arg, num_segments);
+                }
+                throw ngraph_error("Unsupported index type " + index_type.c_type_string() +
+                                   " in CPU Builder for " + op_name);
+            }
+
+            /// \brief Dispatches an embedding sum op on its table and index element types.
+            template <typename Kernel>
+            CPUKernelFunctor build_embedding_sum_functor(CPU_ExternalFunction* external_function,
+                                                         const std::vector<TensorWrapper>& args,
+                                                         const std::vector<TensorWrapper>& out,
+                                                         size_t default_index_arg,
+                                                         size_t num_segments,
+                                                         const std::string& op_name)
+            {
+                auto element_type = out[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    return select_embedding_sum_functor<Kernel, float>(
+                        external_function, args, out, default_index_arg, num_segments, op_name);
+                }
+                else if (element_type == element::bf16)
+                {
+                    return select_embedding_sum_functor<Kernel, bfloat16>(
+                        external_function, args, out, default_index_arg, num_segments, op_name);
+                }
+                else if (element_type == element::f64)
+                {
+                    return select_embedding_sum_functor<Kernel, double>(
+                        external_function, args, out, default_index_arg, num_segments, op_name);
+                }
+                throw ngraph_error("Unsupported element type " + element_type.c_type_string() +
+                                   " in CPU Builder for " + op_name);
+            }
+        }
+    }
+}
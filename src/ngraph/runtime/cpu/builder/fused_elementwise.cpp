@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::FusedElementwise)
+            {
+                auto& functors = external_function->get_functors();
+                auto fused = static_cast<const ngraph::op::FusedElementwise*>(node);
+
+                vector<size_t> arg_buffer_indices;
+                for (const TensorWrapper& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                }
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t count = out[0].get_size();
+                auto program = fused->get_program();
+
+                std::function<decltype(runtime::cpu::kernel::fused_elementwise<float>)> kernel;
+                auto element_type = out[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::fused_elementwise<float>;
+                }
+                else if (element_type == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::fused_elementwise<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " + element_type.c_type_string() +
+                                       " for FusedElementwise");
+                }
+
+                auto functor = [&, kernel, count, program, arg_buffer_indices, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    vector<void*> inputs(arg_buffer_indices.size());
+                    for (size_t i = 0; i < arg_buffer_indices.size(); i++)
+                    {
+                        inputs[i] = ctx->buffer_data[arg_buffer_indices[i]];
+                    }
+                    kernel(inputs, ctx->buffer_data[out_buffer_index], count, program, ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_fused_elementwise_cpp()
+            {
+                REGISTER_OP_BUILDER(FusedElementwise);
+            }
+        }
+    }
+}
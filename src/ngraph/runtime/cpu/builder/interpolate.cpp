@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/interpolate.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/interpolate.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <typename T>
+            static CPUKernelFunctor prepare_interpolate_functor(
+                CPU_ExternalFunction* external_function,
+                const ngraph::op::Interpolate* interpolate,
+                const vector<TensorWrapper>& args,
+                const vector<TensorWrapper>& out)
+            {
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto arg_shape = args[0].get_shape();
+                auto out_shape = out[0].get_shape();
+                auto attrs = interpolate->get_attrs();
+
+                return [arg_shape, out_shape, attrs, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    reference::interpolate<T>(
+                        static_cast<const T*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                        arg_shape,
+                        out_shape,
+                        attrs,
+                        executor::GetCPUExecutor().get_parallel_for(ectx->arena));
+                };
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Interpolate)
+            {
+                auto& functors = external_function->get_functors();
+                auto interpolate = static_cast<const ngraph::op::Interpolate*>(node);
+                auto attrs = interpolate->get_attrs();
+                if (attrs.mode != "nearest" && attrs.mode != "linear")
+                {
+                    throw ngraph_error("Unsupported Interpolate mode '" + attrs.mode + "'");
+                }
+
+                auto element_type = out[0].get_element_type();
+                CPUKernelFunctor functor;
+                if (element_type == element::f32)
+                {
+                    functor = prepare_interpolate_functor<float>(
+                        external_function, interpolate, args, out);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_interpolate_functor<double>(
+                        external_function, interpolate, args, out);
+                }
+                else if (element_type == element::u8)
+                {
+                    functor = prepare_interpolate_functor<uint8_t>(
+                        external_function, interpolate, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " + element_type.c_type_string() +
+                                       " in CPU Builder for Interpolate");
+                }
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_interpolate_cpp() { REGISTER_OP_BUILDER(Interpolate); }
+        }
+    }
+}
@@ -0,0 +1,110 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/layer_norm.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::LayerNorm)
+            {
+                auto& functors = external_function->get_functors();
+                auto ln = static_cast<const ngraph::op::LayerNorm*>(node);
+
+                const Shape& shape = args[0].get_shape();
+                int64_t begin_norm_axis = ln->get_begin_norm_axis();
+                if (begin_norm_axis < 0)
+                {
+                    begin_norm_axis += shape.size();
+                }
+                size_t rows = 1;
+                size_t cols = 1;
+                for (size_t i = 0; i < shape.size(); i++)
+                {
+                    (static_cast<int64_t>(i) < begin_norm_axis ? rows : cols) *= shape[i];
+                }
+                auto epsilon = ln->get_epsilon();
+                bool use_affine = ln->get_use_affine();
+                bool keep_stats = ln->get_keep_stats();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto scale_buffer_index =
+                    use_affine ? external_function->get_buffer_index(args[1].get_name()) : 0;
+                auto bias_buffer_index =
+                    use_affine ? external_function->get_buffer_index(args[2].get_name()) : 0;
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto mean_buffer_index =
+                    keep_stats ? external_function->get_buffer_index(out[1].get_name()) : 0;
+                auto variance_buffer_index =
+                    keep_stats ? external_function->get_buffer_index(out[2].get_name()) : 0;
+
+                std::function<decltype(runtime::cpu::kernel::layer_norm<float>)> kernel;
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::layer_norm<float>;
+                }
+                else if (element_type == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::layer_norm<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " + element_type.c_type_string() +
+                                       " for LayerNorm");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                rows,
+                                cols,
+                                epsilon,
+                                use_affine,
+                                keep_stats,
+                                arg_buffer_index,
+                                scale_buffer_index,
+                                bias_buffer_index,
+                                out_buffer_index,
+                                mean_buffer_index,
+                                variance_buffer_index](CPURuntimeContext* ctx,
+                                                       CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           use_affine ? ctx->buffer_data[scale_buffer_index] : nullptr,
+                           use_affine ? ctx->buffer_data[bias_buffer_index] : nullptr,
+                           ctx->buffer_data[out_buffer_index],
+                           keep_stats ? ctx->buffer_data[mean_buffer_index] : nullptr,
+                           keep_stats ? ctx->buffer_data[variance_buffer_index] : nullptr,
+                           rows,
+                           cols,
+                           epsilon,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_layer_norm_cpp() { REGISTER_OP_BUILDER(LayerNorm); }
+        }
+    }
+}
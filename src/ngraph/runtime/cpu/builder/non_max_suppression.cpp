@@ -0,0 +1,172 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/non_max_suppression.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Scalar inputs such as the thresholds are read when the function is called, so
+            // they may come from parameters as well as constants
+            template <typename T>
+            static T read_scalar(const void* data, const element::Type& type)
+            {
+                switch (type)
+                {
+                case element::Type_t::i32:
+                    return static_cast<T>(*static_cast<const int32_t*>(data));
+                case element::Type_t::i64:
+                    return static_cast<T>(*static_cast<const int64_t*>(data));
+                case element::Type_t::f32: return static_cast<T>(*static_cast<const float*>(data));
+                case element::Type_t::f64:
+                    return static_cast<T>(*static_cast<const double*>(data));
+                default:
+                    throw ngraph_error("Unsupported element type " + type.c_type_string() +
+                                       " for a NonMaxSuppression scalar input");
+                }
+            }
+
+            template <typename T, typename I>
+            static CPUKernelFunctor prepare_nms_functor(CPU_ExternalFunction* external_function,
+                                                        const vector<TensorWrapper>& args,
+                                                        const vector<TensorWrapper>& out,
+                                                        bool center_encoding,
+                                                        bool sort_result_descending)
+            {
+                auto boxes_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto scores_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto max_boxes_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto iou_buffer_index = external_function->get_buffer_index(args[3].get_name());
+                auto score_buffer_index = external_function->get_buffer_index(args[4].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto max_boxes_type = args[2].get_element_type();
+                auto iou_type = args[3].get_element_type();
+                auto score_type = args[4].get_element_type();
+                auto scores_shape = args[1].get_shape();
+                size_t output_rows = out[0].get_shape().at(0);
+
+                return [center_encoding,
+                        sort_result_descending,
+                        boxes_buffer_index,
+                        scores_buffer_index,
+                        max_boxes_buffer_index,
+                        iou_buffer_index,
+                        score_buffer_index,
+                        out_buffer_index,
+                        max_boxes_type,
+                        iou_type,
+                        score_type,
+                        scores_shape,
+                        output_rows](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    reference::NMSParameters params;
+                    params.center_encoding = center_encoding;
+                    params.max_selected = read_scalar<int64_t>(
+                        ctx->buffer_data[max_boxes_buffer_index], max_boxes_type);
+                    params.iou_threshold =
+                        read_scalar<float>(ctx->buffer_data[iou_buffer_index], iou_type);
+                    params.score_threshold =
+                        read_scalar<float>(ctx->buffer_data[score_buffer_index], score_type);
+                    reference::non_max_suppression(
+                        static_cast<const T*>(ctx->buffer_data[boxes_buffer_index]),
+                        static_cast<const T*>(ctx->buffer_data[scores_buffer_index]),
+                        scores_shape,
+                        params,
+                        sort_result_descending,
+                        static_cast<I*>(ctx->buffer_data[out_buffer_index]),
+                        output_rows,
+                        executor::GetCPUExecutor().get_parallel_for(ectx->arena));
+                };
+            }
+
+            template <typename OP>
+            static void build_non_max_suppression(CPU_ExternalFunction* external_function,
+                                                  const ngraph::Node* node,
+                                                  const vector<TensorWrapper>& args,
+                                                  const vector<TensorWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto nms = static_cast<const OP*>(node);
+                bool center_encoding = nms->get_box_encoding() == OP::BoxEncodingType::CENTER;
+                bool sort_result_descending = nms->get_sort_result_descending();
+
+                auto element_type = args[0].get_element_type();
+                auto index_type = out[0].get_element_type();
+                if (index_type != element::i64 && index_type != element::i32)
+                {
+                    throw ngraph_error("Unsupported index element type");
+                }
+                bool is_int64 = index_type == element::i64;
+                CPUKernelFunctor functor;
+                if (element_type == element::f32 && is_int64)
+                {
+                    functor = prepare_nms_functor<float, int64_t>(
+                        external_function, args, out, center_encoding, sort_result_descending);
+                }
+                else if (element_type == element::f32)
+                {
+                    functor = prepare_nms_functor<float, int32_t>(
+                        external_function, args, out, center_encoding, sort_result_descending);
+                }
+                else if (element_type == element::f64 && is_int64)
+                {
+                    functor = prepare_nms_functor<double, int64_t>(
+                        external_function, args, out, center_encoding, sort_result_descending);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_nms_functor<double, int32_t>(
+                        external_function, args, out, center_encoding, sort_result_descending);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " + element_type.c_type_string() +
+                                       " for NonMaxSuppression");
+                }
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::NonMaxSuppression)
+            {
+                build_non_max_suppression<ngraph::op::v1::NonMaxSuppression>(
+                    external_function, node, args, out);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v3::NonMaxSuppression)
+            {
+                build_non_max_suppression<ngraph::op::v3::NonMaxSuppression>(
+                    external_function, node, args, out);
+            }
+
+            void register_builders_non_max_suppression_cpp()
+            {
+                REGISTER_OP_BUILDER(v1::NonMaxSuppression);
+                REGISTER_OP_BUILDER(v3::NonMaxSuppression);
+            }
+        }
+    }
+}
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/roi_align.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/roi_align.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <typename T, typename I>
+            static CPUKernelFunctor
+                prepare_roi_align_functor(CPU_ExternalFunction* external_function,
+                                          const ngraph::op::ROIAlign* roi_align,
+                                          const vector<TensorWrapper>& args,
+                                          const vector<TensorWrapper>& out)
+            {
+                auto data_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto rois_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto batch_indices_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto data_shape = args[0].get_shape();
+                auto out_shape = out[0].get_shape();
+                int sampling_ratio = roi_align->get_sampling_ratio();
+                float spatial_scale = roi_align->get_spatial_scale();
+                bool max_mode = roi_align->get_mode() == ngraph::op::ROIAlign::PoolingMode::MAX;
+
+                return [data_shape,
+                        out_shape,
+                        sampling_ratio,
+                        spatial_scale,
+                        max_mode,
+                        data_buffer_index,
+                        rois_buffer_index,
+                        batch_indices_buffer_index,
+                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    reference::roi_align(
+                        static_cast<const T*>(ctx->buffer_data[data_buffer_index]),
+                        static_cast<const T*>(ctx->buffer_data[rois_buffer_index]),
+                        static_cast<const I*>(ctx->buffer_data[batch_indices_buffer_index]),
+                        static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                        data_shape,
+                        out_shape,
+                        sampling_ratio,
+                        spatial_scale,
+                        max_mode,
+                        executor::GetCPUExecutor().get_parallel_for(ectx->arena));
+                };
+            }
+
+            template <typename T>
+            static CPUKernelFunctor
+                select_roi_align_functor(CPU_ExternalFunction* external_function,
+                                         const ngraph::op::ROIAlign* roi_align,
+                                         const vector<TensorWrapper>& args,
+                                         const vector<TensorWrapper>& out)
+            {
+                auto index_type = args[2].get_element_type();
+                if (index_type == element::i64)
+                {
+                    return prepare_roi_align_functor<T, int64_t>(
+                        external_function, roi_align, args, out);
+                }
+                else if (index_type == element::i32)
+                {
+                    return prepare_roi_align_functor<T, int32_t>(
+                        external_function, roi_align, args, out);
+                }
+                throw ngraph_error("Unsupported index type " + index_type.c_type_string() +
+                                   " in CPU Builder for ROIAlign");
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ROIAlign)
+            {
+                auto& functors = external_function->get_functors();
+                auto roi_align = static_cast<const ngraph::op::ROIAlign*>(node);
+                auto element_type = out[0].get_element_type();
+
+                CPUKernelFunctor functor;
+                if (element_type == element::f32)
+                {
+                    functor =
+                        select_roi_align_functor<float>(external_function, roi_align, args, out);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor =
+                        select_roi_align_functor<double>(external_function, roi_align, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " + element_type.c_type_string() +
+                                       " in CPU Builder for ROIAlign");
+                }
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_roi_align_cpp() { REGISTER_OP_BUILDER(ROIAlign); }
+        }
+    }
+}
@@ -18,8 +18,11 @@
 #include <tbb/tbb_stddef.h>
 #endif
 
+#include <sstream>
+
 #include "cpu_backend_visibility.h"
 
+#include "ngraph/cpio.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -30,6 +33,8 @@
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/structural_hash.hpp"
 #include "ngraph/util.hpp"
 
 #ifdef NGRAPH_MLIR_ENABLE
@@ -59,6 +64,12 @@ extern "C" CPU_BACKEND_API void ngraph_register_cpu_backend()
     });
 }
 
+runtime::cpu::CPU_Backend::CPU_Backend()
+    : m_allocator(nullptr)
+    , m_structural_cache_enabled(getenv_bool("NGRAPH_CPU_STRUCTURAL_CACHE"))
+{
+}
+
 runtime::cpu::CPU_Backend::~CPU_Backend()
 {
     m_exec_map.clear();
@@ -123,15 +134,130 @@ shared_ptr<runtime::Executable>
             return rc;
         }
     }
-    rc = make_shared<CPU_Executable>(
+
+    // A structurally identical function built separately, e.g. by re-importing the same
+    // model, can share the executable. The signature must be taken before compilation since
+    // the CPU passes rewrite func in place. The map is keyed on a hash of the signature and
+    // the full signature is compared on a hash hit.
+    string signature;
+    uint64_t signature_hash = 0;
+    bool use_signature = m_structural_cache_enabled && get_structural_signature(*func, signature);
+    if (use_signature)
+    {
+        signature += get_compile_options_signature(pass_config, performance_counters_enabled);
+        signature_hash = fnv1a_hash(signature.data(), signature.size());
+        std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+        auto range = m_signature_map.equal_range(signature_hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second.m_signature == signature &&
+                constant_data_equal(*func, it->second.m_constants))
+            {
+                rc = it->second.m_executable;
+                m_exec_map.insert({func, rc});
+                return rc;
+            }
+        }
+    }
+
+    StructuralCacheEntry entry;
+    if (use_signature)
+    {
+        // Constants are replaced, never modified, by the passes, so keeping the nodes preserves
+        // the source payloads without cloning the function
+        for (const shared_ptr<Node>& node : func->get_ordered_ops())
+        {
+            if (auto constant = as_type_ptr<op::Constant>(node))
+            {
+                entry.m_constants.push_back(constant);
+            }
+        }
+    }
+
+    auto exec = make_shared<CPU_Executable>(
         func, pass_config, get_host_memory_allocator(), performance_counters_enabled);
+    rc = exec;
     {
         std::lock_guard<std::mutex> guard(m_exec_map_mutex);
         m_exec_map.insert({func, rc});
+        if (use_signature)
+        {
+            entry.m_signature = move(signature);
+            entry.m_executable = exec;
+            m_signature_map.insert({signature_hash, move(entry)});
+        }
         return rc;
     }
 }
 
+string runtime::cpu::CPU_Backend::get_compile_options_signature(
+    const ngraph::pass::PassConfig& pass_config, bool performance_counters_enabled)
+{
+    stringstream options;
+    options << "performance_counters=" << performance_counters_enabled << "\n";
+    for (const pair<string, bool>& p : pass_config.get_enables())
+    {
+        options << "enable " << p.first << " " << p.second << "\n";
+    }
+    for (const pair<string, bool>& p : pass_config.get_pass_attributes())
+    {
+        options << "attribute " << p.first << " " << p.second << "\n";
+    }
+    return options.str();
+}
+
+shared_ptr<runtime::Executable> runtime::cpu::CPU_Backend::load(istream& in)
+{
+    shared_ptr<Executable> exec;
+    cpio::Reader reader(in);
+    map<string, string> entries;
+    for (const cpio::FileInfo& info : reader.get_file_info())
+    {
+        vector<char> buffer = reader.read(info);
+        entries[info.get_name()] = string(buffer.data(), buffer.size());
+    }
+    if (entries["save_info"] == "CPU Save File 1.0")
+    {
+        ngraph::pass::PassConfig pass_config;
+        stringstream config(entries["pass_config"]);
+        string kind;
+        string name;
+        bool value;
+        while (config >> kind >> name >> value)
+        {
+            if (kind == "enable")
+            {
+                pass_config.set_pass_enable(name, value);
+            }
+            else if (kind == "attribute")
+            {
+                pass_config.set_pass_attribute(name, value);
+            }
+        }
+
+        bool performance_counters_enabled = entries["performance_counters"] == "1";
+
+        if (entries.count("optimized_model") != 0)
+        {
+            // Already through the graph passes, and the memory plan is reused
+            shared_ptr<Function> func = deserialize(entries["optimized_model"]);
+            exec = make_shared<CPU_Executable>(func,
+                                               pass_config,
+                                               get_host_memory_allocator(),
+                                               performance_counters_enabled,
+                                               entries["memory_plan"]);
+            std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+            m_exec_map.insert({func, exec});
+        }
+        else
+        {
+            shared_ptr<Function> func = deserialize(entries["model"]);
+            exec = compile(func, pass_config, performance_counters_enabled);
+        }
+    }
+    return exec;
+}
+
 bool runtime::cpu::CPU_Backend::is_supported(const Node& /* op */) const
 {
     return true;
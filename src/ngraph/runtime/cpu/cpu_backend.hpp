@@ -16,11 +16,16 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "cpu_backend_visibility.h"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/backend.hpp"
@@ -39,6 +44,7 @@ namespace ngraph
             class CPU_BACKEND_API CPU_Backend : public runtime::Backend
             {
             public:
+                CPU_Backend();
                 ~CPU_Backend() override;
 
                 std::shared_ptr<CPU_CallFrame>
@@ -68,6 +74,12 @@ namespace ngraph
 
                 void remove_compiled_function(std::shared_ptr<Executable> exec) override;
 
+                /// \brief Loads an executable written by CPU_Executable::save. The CPU graph
+                ///        passes are skipped and the saved memory plan reused when the
+                ///        optimized function was saved, otherwise the saved function is
+                ///        recompiled with the saved pass configuration.
+                std::shared_ptr<Executable> load(std::istream& input_stream) override;
+
                 Allocator* get_host_memory_allocator() override;
                 void set_host_memory_allocator(Allocator* allocator) override;
 
@@ -75,12 +87,30 @@ namespace ngraph
                 bool is_supported_property(const Property prop) const override;
 
             private:
+                static std::string
+                    get_compile_options_signature(const ngraph::pass::PassConfig& pass_config,
+                                                  bool performance_counters_enabled);
+
                 // this mutex will be used to protect the addition and deletion
                 // of function to m_exec_map across multiple threads
                 std::mutex m_exec_map_mutex;
                 std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<Executable>>
                     m_exec_map;
+                struct StructuralCacheEntry
+                {
+                    // Structural signature plus compile options, compared in full on a hash hit
+                    std::string m_signature;
+                    // Constants of the source function in topological order, as they were
+                    // before the CPU passes ran
+                    std::vector<std::shared_ptr<op::Constant>> m_constants;
+                    std::shared_ptr<CPU_Executable> m_executable;
+                };
+                // Executables keyed on a hash of the structural signature of the function they
+                // were compiled from plus the compile options, see get_structural_signature.
+                // Only filled when NGRAPH_CPU_STRUCTURAL_CACHE is set.
+                std::unordered_multimap<uint64_t, StructuralCacheEntry> m_signature_map;
                 Allocator* m_allocator;
+                bool m_structural_cache_enabled;
             };
         }
     }
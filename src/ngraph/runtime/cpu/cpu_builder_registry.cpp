@@ -37,14 +37,20 @@ namespace ngraph
                 register_builders_convert_layout_cpp();
                 register_builders_convolution_cpp();
                 register_builders_cumsum_cpp();
+                register_builders_detection_output_cpp();
                 register_builders_dot_cpp();
                 register_builders_dropout_cpp();
                 register_builders_embedding_lookup_cpp();
+                register_builders_embedding_segments_sum_cpp();
+                register_builders_embeddingbag_offsets_sum_cpp();
                 register_builders_erf_cpp();
+                register_builders_fused_elementwise_cpp();
                 register_builders_gather_cpp();
                 register_builders_gather_nd_cpp();
                 register_builders_gelu_cpp();
                 register_builders_get_output_element_cpp();
+                register_builders_interpolate_cpp();
+                register_builders_layer_norm_cpp();
                 register_builders_leaky_relu_cpp();
                 register_builders_lrn_cpp();
                 register_builders_lstm_cpp();
@@ -52,6 +58,7 @@ namespace ngraph
                 register_builders_max_cpp();
                 register_builders_max_pool_cpp();
                 register_builders_min_cpp();
+                register_builders_non_max_suppression_cpp();
                 register_builders_one_hot_cpp();
                 register_builders_pad_cpp();
                 register_builders_product_cpp();
@@ -67,6 +74,7 @@ namespace ngraph
                 register_builders_reverse_cpp();
                 register_builders_reverse_sequence_cpp();
                 register_builders_rnn_cpp();
+                register_builders_roi_align_cpp();
                 register_builders_scatter_add_cpp();
                 register_builders_scatter_nd_add_cpp();
                 register_builders_select_cpp();
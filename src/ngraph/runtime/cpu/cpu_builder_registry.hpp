@@ -36,14 +36,20 @@ namespace ngraph
             void register_builders_convert_layout_cpp();
             void register_builders_convolution_cpp();
             void register_builders_cumsum_cpp();
+            void register_builders_detection_output_cpp();
             void register_builders_dot_cpp();
             void register_builders_dropout_cpp();
             void register_builders_embedding_lookup_cpp();
+            void register_builders_embedding_segments_sum_cpp();
+            void register_builders_embeddingbag_offsets_sum_cpp();
             void register_builders_erf_cpp();
+            void register_builders_fused_elementwise_cpp();
             void register_builders_gather_cpp();
             void register_builders_gather_nd_cpp();
             void register_builders_gelu_cpp();
             void register_builders_get_output_element_cpp();
+            void register_builders_interpolate_cpp();
+            void register_builders_layer_norm_cpp();
             void register_builders_leaky_relu_cpp();
             void register_builders_lrn_cpp();
             void register_builders_lstm_cpp();
@@ -51,6 +57,7 @@ namespace ngraph
             void register_builders_max_cpp();
             void register_builders_max_pool_cpp();
             void register_builders_min_cpp();
+            void register_builders_non_max_suppression_cpp();
             void register_builders_one_hot_cpp();
             void register_builders_pad_cpp();
             void register_builders_product_cpp();
@@ -66,6 +73,7 @@ namespace ngraph
             void register_builders_reverse_cpp();
             void register_builders_reverse_sequence_cpp();
             void register_builders_rnn_cpp();
+            void register_builders_roi_align_cpp();
             void register_builders_scatter_add_cpp();
             void register_builders_scatter_nd_add_cpp();
             void register_builders_select_cpp();
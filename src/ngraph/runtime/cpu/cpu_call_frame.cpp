@@ -20,6 +20,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
@@ -76,18 +77,26 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     vector<void*> inputs;
     vector<void*> outputs;
 
+    size_t stamp = ++m_call_stamp;
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensor> tv =
             static_pointer_cast<runtime::cpu::CPUTensor>(input_tvs[i]);
-        if (disable_caching)
+        bool stale = disable_caching || tv->get_stale();
+        if (stale)
         {
-            m_ctx_vec[id]->p_en[i] = true;
+            // Other contexts see the change when they next run, however late that is
+            size_t changed = m_input_stamps[i].load();
+            while (changed < stamp && !m_input_stamps[i].compare_exchange_weak(changed, stamp))
+            {
+            }
         }
         else
         {
-            m_ctx_vec[id]->p_en[i] = tv->get_stale();
+            // The hint only covers the previous call, which may have run on another context
+            stale = m_input_stamps[i].load() > m_ctx_stamps[id];
         }
+        m_ctx_vec[id]->p_en[i] = stale;
 
         inputs.push_back(tv->get_data_ptr());
     }
@@ -98,6 +107,8 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    m_ctx_stamps[id] = stamp;
+
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
@@ -116,48 +127,113 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::call(
-    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
-    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+namespace
 {
-    size_t id = 0;
-    auto disable_caching = false;
+    // The context each thread used last, so that a thread issuing back-to-back calls keeps
+    // hitting the same context and its staleness caching hints stay valid.
+    struct ContextAffinity
     {
-        std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
-        {
-            m_cv.wait(lck);
-        }
+        const void* call_frame = nullptr;
+        size_t id = 0;
+    };
+    thread_local ContextAffinity s_context_affinity;
+}
+
+bool runtime::cpu::CPU_CallFrame::try_acquire_context(size_t& id)
+{
+    size_t preferred = 0;
+    if (s_context_affinity.call_frame == this && s_context_affinity.id < m_num_ctx)
+    {
+        preferred = s_context_affinity.id;
+    }
 
-        for (size_t i = 0; i < m_num_ctx; i++)
+    for (size_t i = 0; i < m_num_ctx; i++)
+    {
+        size_t candidate = (preferred + i) % m_num_ctx;
+        bool busy = false;
+        if (!m_ctx_busy[candidate].load() &&
+            m_ctx_busy[candidate].compare_exchange_strong(busy, true))
         {
-            if (m_id_pool[i])
-            {
-                id = i;
-                break;
-            }
+            id = candidate;
+            s_context_affinity.call_frame = this;
+            s_context_affinity.id = candidate;
+            return true;
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
+    }
+    return false;
+}
+
+size_t runtime::cpu::CPU_CallFrame::acquire_context()
+{
+    size_t id = 0;
+    if (!try_acquire_context(id))
+    {
+        // Every context is busy; park until one is released
+        std::unique_lock<std::mutex> lck(m_mutex);
+        m_num_waiters++;
+        m_cv.wait(lck, [&]() { return try_acquire_context(id); });
+        m_num_waiters--;
+    }
+    return id;
+}
+
+void runtime::cpu::CPU_CallFrame::release_context(size_t id)
+{
+    m_ctx_busy[id].store(false);
+    // The store, the waiter count and the waiter's re-check are all sequentially consistent,
+    // so either we see the waiter here or the waiter sees the free context
+    if (m_num_waiters.load() > 0)
+    {
         {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
+            std::lock_guard<std::mutex> lck(m_mutex);
         }
-        m_prev_ctx = id;
-        m_num_ctx_available--;
+        m_cv.notify_one();
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::call(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+{
+    call_on_acquired_context(output_tvs, input_tvs, acquire_context());
+}
+
+void runtime::cpu::CPU_CallFrame::call_on_context(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    size_t id)
+{
+    NGRAPH_CHECK(id < m_num_ctx, "Execution context ", id, " out of range");
+    bool busy = false;
+    while (!m_ctx_busy[id].compare_exchange_weak(busy, true))
+    {
+        busy = false;
+        std::this_thread::yield();
     }
+    call_on_acquired_context(output_tvs, input_tvs, id);
+}
+
+void runtime::cpu::CPU_CallFrame::call_on_acquired_context(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    size_t id)
+{
+    // A context that never ran has nothing cached
+    bool disable_caching = m_ctx_stamps[id] == 0;
 
-    m_ctx_vec[id]->pc = 0;
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+    try
+    {
+        m_ctx_vec[id]->pc = 0;
+        propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+        inner_call(output_tvs, input_tvs, id, disable_caching);
+    }
+    catch (...)
+    {
+        release_context(id);
+        throw;
+    }
 
-    m_mutex.lock();
-    m_id_pool[id] = true;
-    m_num_ctx_available++;
-    m_mutex.unlock();
-    m_cv.notify_one();
+    release_context(id);
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -182,9 +258,17 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
 
 void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
 {
+    size_t num_inputs = m_external_function->get_parameter_layout_descriptors().size();
+    m_input_stamps.reset(new std::atomic<size_t>[num_inputs]);
+    for (size_t i = 0; i < num_inputs; i++)
+    {
+        m_input_stamps[i].store(0);
+    }
+    m_ctx_stamps.assign(m_num_ctx, 0);
+    m_ctx_busy.reset(new std::atomic<bool>[m_num_ctx]);
     for (size_t i = 0; i < m_num_ctx; i++)
     {
-        m_id_pool[i] = true;
+        m_ctx_busy[i].store(false);
         auto ctx = new CPURuntimeContext;
         m_ctx_vec.push_back(ctx);
 
@@ -195,9 +279,15 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
             ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
         }
         ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+        ctx->tensor_stale = new bool[m_external_function->get_stale_count()]();
 
         ctx->first_iteration = true;
 
+        // Spread contexts over the executor's pools; with pinned pools each context's buffers
+        // are first touched from its own pool so they land on that pool's NUMA node
+        auto& executor = runtime::cpu::executor::GetCPUExecutor();
+        ctx->arena = static_cast<int>(i % executor.get_num_thread_pools());
+
         ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
 
         // Create temporary buffer pools
@@ -205,6 +295,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
         {
             auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
+            executor.first_touch(ctx->arena, buffer->get_ptr(), buffer->size());
             ctx->memory_buffers.push_back(buffer);
         }
         const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
@@ -221,6 +312,9 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
             if (scratchpad_size > 0)
             {
                 ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, allocator);
+                executor.first_touch(ctx->arena,
+                                     ctx->scratchpad_buffer->get_ptr(),
+                                     ctx->scratchpad_buffer->size());
             }
             else
             {
@@ -247,7 +341,6 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         }
 #endif
     }
-    m_num_ctx_available = m_num_ctx;
 }
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
@@ -259,6 +352,7 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 
         delete[] ctx->op_durations;
         delete[] ctx->p_en;
+        delete[] ctx->tensor_stale;
         for (auto p : ctx->mkldnn_primitives)
         {
             delete p;
@@ -303,5 +397,4 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 #endif
         delete ctx;
     }
-    m_num_ctx_available = 0;
 }
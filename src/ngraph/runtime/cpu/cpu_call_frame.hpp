@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -70,6 +71,17 @@ namespace ngraph
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+                /// \brief Like call, but runs on execution context id, waiting for it to be
+                ///        released if it is busy. Lets tests and debuggers choose the context.
+                void call_on_context(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                     size_t id);
+
+                /// \brief Number of execution contexts, i.e. calls that may run concurrently.
+                size_t get_concurrency() const { return m_num_ctx; }
+                /// \brief The executor pool that runs the calls made on context id.
+                int get_context_pool(size_t id) const { return m_ctx_vec.at(id)->arena; }
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
@@ -87,14 +99,33 @@ namespace ngraph
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                /// \brief Claims a free execution context without locking, preferring the one
+                ///        the calling thread used last.
+                /// \returns false if every context is busy
+                bool try_acquire_context(size_t& id);
+                size_t acquire_context();
+                void release_context(size_t id);
+                // Runs the call on context id, which the caller has claimed, then releases it
+                void call_on_acquired_context(
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                    size_t id);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
+                // Contexts are claimed by CAS on m_ctx_busy. The mutex and condition variable
+                // are only used to park callers when all contexts are busy.
                 std::mutex m_mutex;
                 std::condition_variable m_cv;
-                volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
+                std::atomic<size_t> m_num_waiters{0};
+                // Caching hints only say whether an input changed since the previous call. Each
+                // call takes a stamp; an input's stamp is the last call that saw it change and a
+                // context's is its last call, so a newer input stamp makes the input stale there.
+                std::atomic<size_t> m_call_stamp{0};
+                std::unique_ptr<std::atomic<size_t>[]> m_input_stamps;
+                std::vector<size_t> m_ctx_stamps;
                 size_t m_num_ctx = 1;
-                std::unordered_map<size_t, bool> m_id_pool;
+                std::unique_ptr<std::atomic<bool>[]> m_ctx_busy;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
 
                 // Codegen specific
@@ -18,8 +18,12 @@
 #include <tbb/tbb_stddef.h>
 #endif
 
+#include <chrono>
+#include <sstream>
+
 #include "cpu_backend_visibility.h"
 
+#include "ngraph/cpio.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -31,6 +35,7 @@
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
+#include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
 #ifdef NGRAPH_MLIR_ENABLE
@@ -44,13 +49,26 @@ using namespace std;
 runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
                                              ngraph::pass::PassConfig& pass_config,
                                              Allocator* allocator,
-                                             bool performance_counters_enabled)
+                                             bool performance_counters_enabled,
+                                             const string& memory_plan)
+    : m_pass_config(pass_config)
 {
+    // The source function is only needed by save(), when the optimized one cannot be serialized
+    if (memory_plan.empty() && pass_config.get_pass_attribute("CPU_Executable::Save"))
+    {
+        m_source_function = clone_function(*func);
+    }
+
     FunctionInstance& instance = m_function_instance;
+    instance.m_performance_counters_enabled = performance_counters_enabled;
     if (instance.m_external_function == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
         instance.m_external_function->m_emit_timing = performance_counters_enabled;
+        if (!memory_plan.empty())
+        {
+            instance.m_external_function->set_optimized(memory_plan);
+        }
         auto cf = instance.m_external_function->make_call_frame(pass_config, allocator);
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
     }
@@ -75,21 +93,92 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
         throw runtime_error("compile() must be called before call().");
     }
 
+    auto start = chrono::high_resolution_clock::now();
     instance.m_call_frame->call(outputs, inputs);
+    if (instance.m_performance_counters_enabled)
+    {
+        m_call_performance.add_call(chrono::high_resolution_clock::now() - start);
+    }
 
     return rc;
 }
 
+void runtime::cpu::CPU_Executable::save(ostream& out)
+{
+    const shared_ptr<CPU_ExternalFunction>& external_function =
+        m_function_instance.m_external_function;
+    shared_ptr<Function> optimized = external_function->get_optimized_function();
+    if (optimized == nullptr)
+    {
+        throw ngraph_error("CPU_Executable::save requires compiling with the "
+                           "CPU_Executable::Save pass attribute, e.g. through "
+                           "NGRAPH_PASS_ATTRIBUTES=CPU_Executable::Save");
+    }
+
+    cpio::Writer writer(out);
+    string si = "CPU Save File 1.0";
+    writer.write("save_info", si.data(), si.size());
+    string model;
+    try
+    {
+        model = serialize(optimized, 0);
+    }
+    catch (const exception& e)
+    {
+        // CPU-only ops from the fusion passes have no serialized form
+        NGRAPH_DEBUG << "Saving the function from before the CPU passes: " << e.what();
+    }
+    if (!model.empty())
+    {
+        const string& plan = external_function->get_memory_plan();
+        writer.write("optimized_model", model.data(), model.size());
+        writer.write("memory_plan", plan.data(), plan.size());
+    }
+    else
+    {
+        NGRAPH_CHECK(m_source_function, "No serializable form of the compiled function");
+        model = serialize(m_source_function, 0);
+        writer.write("model", model.data(), model.size());
+    }
+
+    // One "enable|attribute <name> <0|1>" line per configured pass setting
+    stringstream config;
+    for (const pair<string, bool>& p : m_pass_config.get_enables())
+    {
+        config << "enable " << p.first << " " << p.second << "\n";
+    }
+    for (const pair<string, bool>& p : m_pass_config.get_pass_attributes())
+    {
+        config << "attribute " << p.first << " " << p.second << "\n";
+    }
+    string config_string = config.str();
+    writer.write("pass_config", config_string.data(), config_string.size());
+
+    string timing = m_function_instance.m_performance_counters_enabled ? "1" : "0";
+    writer.write("performance_counters", timing.data(), timing.size());
+}
+
+future<bool> runtime::cpu::CPU_Executable::async_call(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    function<void(bool)> callback)
+{
+    // With a single execution context concurrent calls would only block pool threads
+    bool serialize = m_function_instance.m_call_frame->get_concurrency() == 1;
+    return submit_async_call(outputs, inputs, move(callback), serialize);
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     std::lock_guard<std::mutex> guard(m_exec_map_mutex);
-    for (auto it = m_exec_map.begin(); it != m_exec_map.end(); ++it)
+    // Several functions may share one executable through the structural cache
+    for (auto it = m_exec_map.begin(); it != m_exec_map.end();)
     {
-        if (it->second == exec)
-        {
-            m_exec_map.erase(it);
-            break;
-        }
+        it = (it->second == exec) ? m_exec_map.erase(it) : next(it);
+    }
+    for (auto it = m_signature_map.begin(); it != m_signature_map.end();)
+    {
+        it = (it->second.m_executable == exec) ? m_signature_map.erase(it) : next(it);
     }
 }
 
@@ -120,13 +209,16 @@ vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performanc
     const FunctionInstance& instance = m_function_instance;
     if (instance.m_external_function != nullptr)
     {
-        rc.insert(rc.end(),
-                  instance.m_external_function->get_perf_counters().begin(),
-                  instance.m_external_function->get_perf_counters().end());
+        rc = instance.m_external_function->get_perf_counters();
     }
     return rc;
 }
 
+runtime::PerformanceCounter runtime::cpu::CPU_Executable::get_call_performance_data() const
+{
+    return m_call_performance.get_counter(nullptr);
+}
+
 shared_ptr<ngraph::op::Parameter> runtime::cpu::CPU_Executable::get_parameter(size_t index) const
 {
     const ParameterVector& parameters = get_parameters();
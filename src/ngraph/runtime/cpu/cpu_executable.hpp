@@ -37,17 +37,38 @@ namespace ngraph
             class CPU_BACKEND_API CPU_Executable : public runtime::Executable
             {
             public:
+                /// \param memory_plan Non-empty when func was saved by save() after the graph
+                ///        passes, which are then skipped, together with this memory plan.
                 CPU_Executable(std::shared_ptr<Function> func,
                                ngraph::pass::PassConfig& pass_config,
                                Allocator* allocator,
-                               bool performance_counters_enabled);
+                               bool performance_counters_enabled,
+                               const std::string& memory_plan = "");
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+                /// \brief Calls run concurrently when NGRAPH_CPU_CONCURRENCY > 1, each on its
+                ///        own CPU_CallFrame execution context.
+                std::future<bool>
+                    async_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                               std::function<void(bool)> callback = nullptr) override;
+
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Saves the function as rewritten by the CPU graph passes with its memory
+                ///        plan and the pass configuration, so CPU_Backend::load skips those
+                ///        passes. Functions holding CPU-only ops are saved as they were before
+                ///        the passes instead. Requires compiling with the "CPU_Executable::Save"
+                ///        pass attribute, set on the PassConfig given to compile() or through
+                ///        NGRAPH_PASS_ATTRIBUTES, since keeping the optimized function and
+                ///        memory plan costs a copy of the graph. Throws ngraph_error otherwise.
+                void save(std::ostream& output_stream) override;
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+                PerformanceCounter get_call_performance_data() const override;
+
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index,
@@ -84,6 +105,12 @@ namespace ngraph
                     std::shared_ptr<CPU_CallFrame> m_call_frame = nullptr;
                     bool m_performance_counters_enabled = false;
                 } m_function_instance;
+                // Calls can run concurrently on several call frame contexts
+                ConcurrentPerformanceCounter m_call_performance;
+                // The CPU passes rewrite the compiled function in place, so save() falls back on
+                // a copy taken before compilation. Constant data is shared with the original.
+                std::shared_ptr<Function> m_source_function;
+                ngraph::pass::PassConfig m_pass_config;
             };
         }
     }
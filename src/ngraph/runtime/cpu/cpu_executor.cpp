@@ -14,12 +14,22 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 #include <thread>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include "cpu_executor.hpp"
 
 #include "ngraph/env_util.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
 
 #define MAX_PARALLELISM_THRESHOLD 2
 
@@ -68,6 +78,140 @@ static int GetNumThreadPools()
     return count < 1 ? 1 : count;
 }
 
+// Parses a Linux style cpu list such as "0-3,8,10-11"
+static std::vector<int> ParseCoreList(const std::string& list)
+{
+    std::vector<int> cores;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ','))
+    {
+        if (range.find_first_not_of(" \t\n") == std::string::npos)
+        {
+            continue;
+        }
+        try
+        {
+            size_t dash = range.find('-');
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            if (first < 0 || last < first)
+            {
+                throw std::invalid_argument(range);
+            }
+            for (int core = first; core <= last; core++)
+            {
+                cores.push_back(core);
+            }
+        }
+        catch (const std::logic_error&)
+        {
+            throw ngraph::ngraph_error("Invalid core range '" + range + "' in core list '" + list +
+                                       "'");
+        }
+    }
+    return cores;
+}
+
+// Cores of each NUMA node that has any, empty if the topology is not available
+static std::vector<std::vector<int>> GetNumaNodeCores()
+{
+    std::vector<std::vector<int>> nodes;
+    for (int node = 0;; node++)
+    {
+        std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!in)
+        {
+            break;
+        }
+        std::string list;
+        std::getline(in, list);
+        auto cores = ParseCoreList(list);
+        if (!cores.empty())
+        {
+            nodes.push_back(cores);
+        }
+    }
+    return nodes;
+}
+
+// Core sets for pinned pools from NGRAPH_CPU_POOL_CORES or NGRAPH_CPU_NUMA_POOLS, empty when
+// the pools should not be pinned
+static std::vector<std::vector<int>> GetPoolCores()
+{
+    std::vector<std::vector<int>> pool_cores;
+    std::string pool_cores_env = ngraph::getenv_string("NGRAPH_CPU_POOL_CORES");
+    if (!pool_cores_env.empty())
+    {
+        std::stringstream ss(pool_cores_env);
+        std::string list;
+        while (std::getline(ss, list, ';'))
+        {
+            auto cores = ParseCoreList(list);
+            if (!cores.empty())
+            {
+                pool_cores.push_back(cores);
+            }
+        }
+        if (pool_cores.empty())
+        {
+            throw ngraph::ngraph_error("NGRAPH_CPU_POOL_CORES does not contain any cores");
+        }
+    }
+    else if (ngraph::getenv_bool("NGRAPH_CPU_NUMA_POOLS"))
+    {
+        pool_cores = GetNumaNodeCores();
+        if (pool_cores.empty())
+        {
+            NGRAPH_WARN << "NGRAPH_CPU_NUMA_POOLS is set but the NUMA topology is not available; "
+                           "using unpinned thread pools";
+        }
+    }
+    return pool_cores;
+}
+
+static void PinCurrentThread(const std::vector<int>& cores)
+{
+#if defined(__linux__)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (int core : cores)
+    {
+        if (core < CPU_SETSIZE)
+        {
+            CPU_SET(core, &cpuset);
+        }
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0)
+    {
+        NGRAPH_WARN << "Unable to pin executor thread to its core set";
+    }
+#else
+    (void)cores;
+#endif
+}
+
+// Eigen thread environment whose threads pin themselves to a core set before running
+struct PinnedThreadEnvironment : public Eigen::StlThreadEnvironment
+{
+    PinnedThreadEnvironment() = default;
+    explicit PinnedThreadEnvironment(const std::vector<int>& cores)
+        : m_cores(cores)
+    {
+    }
+
+    EnvThread* CreateThread(std::function<void()> f)
+    {
+        auto cores = m_cores;
+        return Eigen::StlThreadEnvironment::CreateThread([cores, f]() {
+            PinCurrentThread(cores);
+            f();
+        });
+    }
+
+    std::vector<int> m_cores;
+};
+
 namespace ngraph
 {
     namespace runtime
@@ -77,16 +221,36 @@ namespace ngraph
             namespace executor
             {
                 CPUExecutor::CPUExecutor(int num_thread_pools)
-                    : m_num_thread_pools(num_thread_pools)
                 {
                     m_num_cores = GetNumCores();
+                    m_pool_cores = GetPoolCores();
+                    bool pinned = !m_pool_cores.empty();
+                    if (pinned)
+                    {
+                        num_thread_pools = static_cast<int>(m_pool_cores.size());
+                    }
+                    else
+                    {
+                        m_pool_cores.resize(num_thread_pools);
+                    }
+                    m_num_thread_pools = num_thread_pools;
+
                     for (int i = 0; i < num_thread_pools; i++)
                     {
                         int num_threads_per_pool;
 
                         // Eigen threadpool will still be used for reductions
-                        // and other tensor operations that dont use a parallelFor
-                        num_threads_per_pool = GetNumCores();
+                        // and other tensor operations that dont use a parallelFor.
+                        // Pinned pools get one thread per core in their set, unpinned pools
+                        // split the cores between them rather than each taking all of them.
+                        if (pinned)
+                        {
+                            num_threads_per_pool = static_cast<int>(m_pool_cores[i].size());
+                        }
+                        else
+                        {
+                            num_threads_per_pool = std::max(1, GetNumCores() / num_thread_pools);
+                        }
 
                         // User override
                         int32_t eigen_tp_count =
@@ -106,8 +270,18 @@ namespace ngraph
                             num_threads_per_pool = tp_count;
                         }
 
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
+                        if (pinned)
+                        {
+                            m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPoolInterface>(
+                                new Eigen::ThreadPoolTempl<PinnedThreadEnvironment>(
+                                    num_threads_per_pool,
+                                    PinnedThreadEnvironment(m_pool_cores[i]))));
+                        }
+                        else
+                        {
+                            m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPoolInterface>(
+                                new Eigen::ThreadPool(num_threads_per_pool)));
+                        }
                         m_thread_pool_devices.push_back(
                             std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
                                 m_thread_pools[i].get(), num_threads_per_pool)));
@@ -117,6 +291,38 @@ namespace ngraph
                     }
                 }
 
+                void CPUExecutor::first_touch(int id, void* ptr, size_t size)
+                {
+                    if (m_pool_cores[id].empty() || ptr == nullptr || size == 0)
+                    {
+                        return;
+                    }
+                    Eigen::Barrier barrier(1);
+                    m_thread_pools[id]->Schedule([&]() {
+                        std::memset(ptr, 0, size);
+                        barrier.Notify();
+                    });
+                    barrier.Wait();
+                }
+
+                runtime::ParallelFor CPUExecutor::get_parallel_for(int id)
+                {
+                    Eigen::ThreadPoolDevice* device = m_thread_pool_devices[id].get();
+                    return [device](size_t count,
+                                    size_t grain,
+                                    const std::function<void(size_t, size_t)>& body) {
+                        grain = std::max<size_t>(grain, 1);
+                        size_t blocks = (count + grain - 1) / grain;
+                        // Kernels pick grain so that a block is worth a task of its own
+                        Eigen::TensorOpCost cost(0, 0, 100000);
+                        device->parallelFor(
+                            blocks, cost, [&](Eigen::Index first, Eigen::Index last) {
+                                body(static_cast<size_t>(first) * grain,
+                                     std::min(count, static_cast<size_t>(last) * grain));
+                            });
+                    };
+                }
+
 #if defined(NGRAPH_TBB_ENABLE)
                 void CPUExecutor::execute(CPUKernelFunctor& f,
                                           CPURuntimeContext* ctx,
@@ -18,10 +18,12 @@
 
 #include <functional>
 #include <thread>
+#include <vector>
 
 #include <mkldnn.hpp>
 
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
@@ -41,6 +43,11 @@ namespace ngraph
                 extern mkldnn::engine global_cpu_engine;
 
                 // CPUExecutor owns the resources for executing a graph.
+                //
+                // By default it creates num_thread_pools unpinned pools that share the cores.
+                // With NGRAPH_CPU_POOL_CORES (core sets separated by ';', e.g. "0-7;8-15") or
+                // NGRAPH_CPU_NUMA_POOLS (one set per NUMA node) it instead creates one pool per
+                // core set, with one thread pinned to the set per core.
                 class CPUExecutor
                 {
                 public:
@@ -63,12 +70,28 @@ namespace ngraph
 #endif
                     int get_num_thread_pools() { return m_num_thread_pools; }
                     int get_num_cores() { return m_num_cores; }
+                    /// \brief The cores the threads of a pool are pinned to, empty if unpinned
+                    const std::vector<int>& get_pool_cores(int id) const
+                    {
+                        return m_pool_cores[id];
+                    }
+
+                    /// \brief Writes zeros over memory from a thread of a pinned pool, so that
+                    ///        under the first-touch policy its pages are placed on the NUMA node
+                    ///        of that pool. Does nothing for unpinned pools.
+                    void first_touch(int id, void* ptr, size_t size);
+
+                    /// \brief A runtime::ParallelFor on pool id, for builders that call
+                    ///        reference kernels. Each grain-sized block is scheduled as a task.
+                    runtime::ParallelFor get_parallel_for(int id);
+
                 private:
-                    std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
+                    std::vector<std::unique_ptr<Eigen::ThreadPoolInterface>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
 #if defined(NGRAPH_TBB_ENABLE)
                     std::vector<tbb::task_arena> m_tbb_arenas;
 #endif
+                    std::vector<std::vector<int>> m_pool_cores;
                     int m_num_thread_pools;
                     int m_num_cores;
                 };
@@ -16,7 +16,9 @@
 
 #include <cstdlib>
 #include <fstream>
+#include <map>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <tuple>
 #include <typeindex>
@@ -88,6 +90,7 @@
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/gemm.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
 #include "ngraph/op/fused/lstm_cell.hpp"
 #include "ngraph/op/fused/matmul.hpp"
 #include "ngraph/op/fused/softmax_crossentropy.hpp"
@@ -198,6 +201,7 @@
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
@@ -1183,6 +1187,14 @@ using namespace ngraph::runtime;
 
 void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     ngraph::pass::Manager& pass_manager, ngraph::pass::PassConfig& pass_config)
+{
+    register_graph_passes(pass_manager, pass_config);
+    register_backend_passes(pass_manager, pass_config);
+    register_memory_assignment(pass_manager, pass_config);
+}
+
+void runtime::cpu::CPU_ExternalFunction::register_graph_passes(
+    ngraph::pass::Manager& pass_manager, ngraph::pass::PassConfig& pass_config)
 {
     auto pass_map = pass_config.get_enables();
 
@@ -1233,6 +1245,15 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         {
             return false;
         }
+        // The native LayerNorm kernel only handles floating point types
+        else if (typeid(ngraph::op::LayerNorm) == typeid(node))
+        {
+            auto et = node.get_input_element_type(0);
+            if (et != element::f32 && et != element::f64)
+            {
+                return false;
+            }
+        }
         // GroupConvolution is only supported with MKLDNN
         else if (auto conv = as_type<ngraph::op::GroupConvolution>(const_cast<Node*>(&node)))
         {
@@ -1297,6 +1318,18 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass)
+    // FusedElementwise only has a DEX builder
+    if (dex)
+    {
+#ifdef NGRAPH_MLIR_ENABLE
+        if (!getenv_bool("NGRAPH_MLIR"))
+        {
+#endif
+            REGISTER_KNOBBED_PASS(CPUElementwiseFusion, true, runtime::cpu::pass)
+#ifdef NGRAPH_MLIR_ENABLE
+        }
+#endif
+    }
 
 #ifdef NGRAPH_MLIR_ENABLE
     if (getenv_bool("NGRAPH_MLIR"))
@@ -1304,6 +1337,12 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         REGISTER_KNOBBED_PASS(MLIRSubgraphExtractionPass, /*enable by default*/ true, ngraph::pass)
     }
 #endif
+}
+
+void runtime::cpu::CPU_ExternalFunction::register_backend_passes(
+    ngraph::pass::Manager& pass_manager, ngraph::pass::PassConfig& pass_config)
+{
+    auto pass_map = pass_config.get_enables();
 
     NodeVector nv_cwi; // We dont need CPUWorkspaceInsertion to return list of indices
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false)
@@ -1318,12 +1357,167 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory())
+
+    pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
+}
+
+void runtime::cpu::CPU_ExternalFunction::register_memory_assignment(
+    ngraph::pass::Manager& pass_manager, ngraph::pass::PassConfig& pass_config)
+{
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                         pass_config.get_pass_attribute("ReuseMemory");
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
         bufferID_to_tensorSets, tensor_to_bufferID, size_t(s_memory_pool_alignment), !reuse_memory);
+}
 
-    pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
+void runtime::cpu::CPU_ExternalFunction::set_optimized(const string& memory_plan)
+{
+    m_optimized = true;
+    m_memory_plan = memory_plan;
+}
+
+// One line per fact, with tensors named by their position in the ordered ops:
+//   ops <count>, pool <temporary pool size>, buffer <id> <role>,
+//   offset <op> <output> <pool offset> <size>, member <buffer id> <op> <output>
+string runtime::cpu::CPU_ExternalFunction::record_memory_plan() const
+{
+    vector<shared_ptr<Node>> ops = m_function->get_ordered_ops();
+    unordered_map<const descriptor::Tensor*, pair<size_t, size_t>> positions;
+    stringstream plan;
+    plan << "ops " << ops.size() << "\n";
+    plan << "pool " << m_function->get_temporary_pool_size() << "\n";
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        for (size_t j = 0; j < ops[i]->get_output_size(); ++j)
+        {
+            const descriptor::Tensor& tensor = ops[i]->get_output_tensor(j);
+            positions[&tensor] = make_pair(i, j);
+            plan << "offset " << i << " " << j << " " << tensor.get_pool_offset() << " "
+                 << tensor.size() << "\n";
+        }
+    }
+    for (auto& buffer : bufferID_to_tensorSets)
+    {
+        plan << "buffer " << buffer.first << " " << static_cast<int>(buffer.second.first) << "\n";
+        for (descriptor::Tensor* tensor : buffer.second.second)
+        {
+            auto position = positions.find(tensor);
+            NGRAPH_CHECK(position != positions.end(), "Buffer member ", tensor->get_name());
+            plan << "member " << buffer.first << " " << position->second.first << " "
+                 << position->second.second << "\n";
+        }
+    }
+    return plan.str();
+}
+
+bool runtime::cpu::CPU_ExternalFunction::apply_memory_plan(const string& memory_plan)
+{
+    vector<shared_ptr<Node>> ops = m_function->get_ordered_ops();
+    auto get_tensor = [&ops](size_t op, size_t output) -> descriptor::Tensor* {
+        if (op >= ops.size() || output >= ops[op]->get_output_size())
+        {
+            return nullptr;
+        }
+        return &ops[op]->get_output_tensor(output);
+    };
+
+    // Parsed and checked completely before anything is assigned, so a plan that does not
+    // match the lowered function leaves it untouched
+    size_t pool_size = 0;
+    unordered_map<descriptor::Tensor*, size_t> offsets;
+    map<size_t, TensorRole> roles;
+    vector<pair<size_t, descriptor::Tensor*>> members;
+    stringstream plan(memory_plan);
+    string kind;
+    while (plan >> kind)
+    {
+        size_t a = 0;
+        size_t b = 0;
+        size_t c = 0;
+        if (kind == "ops")
+        {
+            if (!(plan >> a) || a != ops.size())
+            {
+                return false;
+            }
+        }
+        else if (kind == "pool")
+        {
+            if (!(plan >> pool_size))
+            {
+                return false;
+            }
+        }
+        else if (kind == "buffer")
+        {
+            if (!(plan >> a >> b) || b > static_cast<size_t>(TensorRole::UNKNOWN))
+            {
+                return false;
+            }
+            roles[a] = static_cast<TensorRole>(b);
+        }
+        else if (kind == "offset")
+        {
+            size_t size = 0;
+            if (!(plan >> a >> b >> c >> size))
+            {
+                return false;
+            }
+            // The layout passes must have given the tensor the size it was planned with
+            descriptor::Tensor* tensor = get_tensor(a, b);
+            if (tensor == nullptr || tensor->size() != size || !offsets.insert({tensor, c}).second)
+            {
+                return false;
+            }
+        }
+        else if (kind == "member")
+        {
+            if (!(plan >> a >> b >> c))
+            {
+                return false;
+            }
+            descriptor::Tensor* tensor = get_tensor(b, c);
+            if (tensor == nullptr || roles.count(a) == 0)
+            {
+                return false;
+            }
+            members.emplace_back(a, tensor);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // Intermediates live in the temporary pool and must fit in it
+    for (auto& member : members)
+    {
+        if (roles[member.first] == TensorRole::INTERMEDIATE)
+        {
+            auto offset = offsets.find(member.second);
+            if (offset == offsets.end() || offset->second > pool_size ||
+                member.second->size() > pool_size - offset->second)
+            {
+                return false;
+            }
+        }
+    }
+
+    for (auto& offset : offsets)
+    {
+        offset.first->set_pool_offset(offset.second);
+    }
+    for (auto& role : roles)
+    {
+        bufferID_to_tensorSets[role.first].first = role.second;
+    }
+    for (auto& member : members)
+    {
+        bufferID_to_tensorSets[member.first].second.insert(member.second);
+        tensor_to_bufferID[member.second] = member.first;
+    }
+    m_function->set_temporary_pool_size(pool_size);
+    return true;
 }
 
 bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
@@ -1431,6 +1625,16 @@ void runtime::cpu::CPU_ExternalFunction::dump_one_kernel(CPU_DebugTracer& debug_
     }
 }
 
+size_t runtime::cpu::CPU_ExternalFunction::get_stale_index(const string& name)
+{
+    auto it = m_stale_indices.find(name);
+    if (it == m_stale_indices.end())
+    {
+        it = m_stale_indices.insert({name, m_stale_indices.size()}).first;
+    }
+    return it->second;
+}
+
 void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_config)
 {
     if (m_is_built)
@@ -1452,13 +1656,44 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     static StaticInitializers s_static_initializers(s_debug_dir);
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
     ngraph::pass::Manager pass_manager;
+    ngraph::pass::Manager backend_pass_manager;
     if (getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING"))
     {
         // Enable per_pass_validation if required for debug purpose
         pass_manager.set_per_pass_validation(false);
+        backend_pass_manager.set_per_pass_validation(false);
+    }
+    // A function saved by CPU_Executable::save has been through the graph passes already
+    if (!m_optimized)
+    {
+        register_graph_passes(pass_manager, pass_config);
+        pass_manager.run_passes(m_function, false);
+    }
+    bool keep_compiled_state = pass_config.get_pass_attribute("CPU_Executable::Save");
+    if (keep_compiled_state)
+    {
+        m_optimized_function = clone_function(*m_function);
+    }
+
+    register_backend_passes(backend_pass_manager, pass_config);
+    bool restore_memory_plan = m_optimized && !m_memory_plan.empty();
+    if (!restore_memory_plan)
+    {
+        register_memory_assignment(backend_pass_manager, pass_config);
+    }
+    backend_pass_manager.run_passes(m_function, false);
+    if (restore_memory_plan && !apply_memory_plan(m_memory_plan))
+    {
+        NGRAPH_WARN << "Saved memory plan does not match " << m_function->get_name()
+                    << ", running memory assignment";
+        ngraph::pass::Manager memory_pass_manager;
+        register_memory_assignment(memory_pass_manager, pass_config);
+        memory_pass_manager.run_passes(m_function, false);
+    }
+    if (keep_compiled_state)
+    {
+        m_memory_plan = record_memory_plan();
     }
-    register_common_passes(pass_manager, pass_config);
-    pass_manager.run_passes(m_function, false);
 
     static runtime::cpu::CPU_DebugTracer debug_tracer;
     if (getenv_bool("NGRAPH_CPU_DEBUG_TRACER"))
@@ -1558,7 +1793,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             auto output_tensor = &param->get_outputs().at(i).get_tensor();
             auto tensor_set = get_tensor_set(output_tensor);
 
-            auto& stale = tensor_stale[output_tensor->get_name()];
+            size_t stale = get_stale_index(output_tensor->get_name());
             // process all tensors in the set containing the output tensor of the parameter
             for (auto& ele_t : tensor_set)
             {
@@ -1652,56 +1887,58 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
              !cacheable) // Check cacheability only if we are reusing intermediate tensors
             || computes_result(node.get()) || possibly_overwritten(node.get()) || node->has_state();
 
-        vector<reference_wrapper<bool>> in_stale, out_stale;
+        // Slots in each context's tensor_stale array, since every context caches its own
+        // intermediates
+        vector<size_t> in_stale, out_stale;
         for (const auto& name : in_names)
         {
             if (tensor_alias.count(name))
             {
-                in_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                in_stale.push_back(get_stale_index(tensor_alias[name]));
             }
             else
             {
-                in_stale.emplace_back(tensor_stale[name]);
+                in_stale.push_back(get_stale_index(name));
             }
         }
         for (const auto& name : out_names)
         {
             if (tensor_alias.count(name))
             {
-                out_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                out_stale.push_back(get_stale_index(tensor_alias[name]));
             }
             else
             {
-                out_stale.emplace_back(tensor_stale[name]);
+                out_stale.push_back(get_stale_index(name));
             }
         }
 
         function<bool(CPURuntimeContext*)> enable;
         if (disable_caching)
         {
-            enable = [in_stale, out_stale](CPURuntimeContext * /* ctx */) -> bool {
-                for (auto& stale : out_stale)
+            enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
+                for (size_t stale : out_stale)
                 {
-                    stale.get() = true;
+                    ctx->tensor_stale[stale] = true;
                 }
                 return true;
             };
         }
         else
         {
-            enable = [in_stale, out_stale](CPURuntimeContext * /* ctx */) -> bool {
+            enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
                 bool en = false;
-                for (const auto& stale : in_stale)
+                for (size_t stale : in_stale)
                 {
-                    if (stale)
+                    if (ctx->tensor_stale[stale])
                     {
                         en = true;
                         break;
                     }
                 }
-                for (auto& stale : out_stale)
+                for (size_t stale : out_stale)
                 {
-                    stale.get() = en;
+                    ctx->tensor_stale[stale] = en;
                 }
                 return en;
             };
@@ -1712,6 +1949,12 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         m_perf_counters.emplace_back(node, 0, 0);
     }
+    // Call frames run the functors concurrently, so timings go to atomic counters. Each counter
+    // carries a full latency histogram, so only pay for them when timing is enabled.
+    if (m_emit_timing)
+    {
+        m_op_timers.reset(new runtime::ConcurrentPerformanceCounter[m_perf_counters.size()]);
+    }
 
     if (getenv_bool("NGRAPH_DEX_DEBUG"))
     {
@@ -1798,7 +2041,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         for (const auto& p : function_input_index_offset)
         {
             ctx->buffer_data[get<0>(p)] = static_cast<uint8_t*>(inputs[get<1>(p)]) + get<2>(p);
-            get<3>(p).get() = ctx->p_en[get<1>(p)];
+            ctx->tensor_stale[get<3>(p)] = ctx->p_en[get<1>(p)];
         }
 
         for (const auto& p : function_output_index_offset)
@@ -1832,7 +2075,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    CPUExecutionContext ectx{0};
+                                    CPUExecutionContext ectx{ctx->arena};
                                     executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
@@ -1847,11 +2090,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                         }
                                         if (m_emit_timing)
                                         {
-                                            m_perf_counters[index].m_total_microseconds +=
+                                            m_op_timers[index].add_call(
                                                 std::chrono::duration_cast<
-                                                    std::chrono::microseconds>(end_ts - start_ts)
-                                                    .count();
-                                            m_perf_counters[index].m_call_count++;
+                                                    std::chrono::nanoseconds>(end_ts - start_ts));
                                         }
                                     }
                                 }
@@ -1863,7 +2104,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                     }
                                     if (m_emit_timing)
                                     {
-                                        m_perf_counters[index].m_call_count++;
+                                        m_op_timers[index].add_untimed_call();
                                     }
                                 }
                             });
@@ -1960,7 +2201,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         start_ts = cpu::Clock::now();
                     }
 
-                    CPUExecutionContext ectx{0};
+                    CPUExecutionContext ectx{ctx->arena};
 
                     if (debug_tracer.tracing_is_enabled())
                     {
@@ -1992,11 +2233,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         }
                         if (m_emit_timing)
                         {
-                            m_perf_counters[index].m_total_microseconds +=
-                                std::chrono::duration_cast<std::chrono::microseconds>(end_ts -
-                                                                                      start_ts)
-                                    .count();
-                            m_perf_counters[index].m_call_count++;
+                            m_op_timers[index].add_call(
+                                std::chrono::duration_cast<std::chrono::nanoseconds>(end_ts -
+                                                                                     start_ts));
                         }
                     }
                 }
@@ -2008,7 +2247,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                     }
                     if (m_emit_timing)
                     {
-                        m_perf_counters[index].m_call_count++;
+                        m_op_timers[index].add_untimed_call();
                     }
                 }
             }
@@ -2104,8 +2343,17 @@ const runtime::cpu::LayoutDescriptorPtrs&
     return result_layout_descriptors;
 }
 
-const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::get_perf_counters()
+vector<runtime::PerformanceCounter> runtime::cpu::CPU_ExternalFunction::get_perf_counters()
 {
+    if (m_op_timers)
+    {
+        vector<runtime::PerformanceCounter> counters;
+        for (size_t i = 0; i < m_perf_counters.size(); i++)
+        {
+            counters.push_back(m_op_timers[i].get_counter(m_perf_counters[i].get_node()));
+        }
+        return counters;
+    }
 #if !defined(NGRAPH_DEX_ONLY)
     // Codegen. Retrieve perf counters from compiled module
     if (m_execution_engine)
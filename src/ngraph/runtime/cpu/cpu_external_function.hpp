@@ -163,6 +163,8 @@ namespace ngraph
                 // tensor
                 size_t get_buffer_index(const std::string& name);
                 size_t get_buffer_size() const { return m_buffer_size; }
+                // number of entries in each context's tensor_stale array
+                size_t get_stale_count() const { return m_stale_indices.size(); }
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -178,7 +180,21 @@ namespace ngraph
                                    const std::string& directory,
                                    const std::string& filename);
 
-                const std::vector<PerformanceCounter>& get_perf_counters();
+                std::vector<PerformanceCounter> get_perf_counters();
+
+                /// \brief Marks the function as already rewritten by the CPU graph passes, as
+                ///        saved by CPU_Executable::save. build() then only runs the layout passes
+                ///        and takes memory_plan instead of running CPUMemoryAssignment.
+                void set_optimized(const std::string& memory_plan);
+                /// \brief The function after the graph passes, kept when the
+                ///        "CPU_Executable::Save" pass attribute is set.
+                std::shared_ptr<ngraph::Function> get_optimized_function() const
+                {
+                    return m_optimized_function;
+                }
+                /// \brief The memory plan of the built function, kept when the
+                ///        "CPU_Executable::Save" pass attribute is set.
+                const std::string& get_memory_plan() const { return m_memory_plan; }
 
             protected:
                 void build(ngraph::pass::PassConfig& pass_config);
@@ -199,8 +215,20 @@ namespace ngraph
                 // Register passes that are common to codegen and DEX
                 void register_common_passes(ngraph::pass::Manager& pass_manager,
                                             ngraph::pass::PassConfig& pass_config);
+                // The graph rewrites, whose result is still a plain serializable function
+                void register_graph_passes(ngraph::pass::Manager& pass_manager,
+                                           ngraph::pass::PassConfig& pass_config);
+                // Assignment, layout and the clean-ups that follow them
+                void register_backend_passes(ngraph::pass::Manager& pass_manager,
+                                             ngraph::pass::PassConfig& pass_config);
+                void register_memory_assignment(ngraph::pass::Manager& pass_manager,
+                                                ngraph::pass::PassConfig& pass_config);
+                std::string record_memory_plan() const;
+                // Returns false, without changing anything, if the plan does not match
+                bool apply_memory_plan(const std::string& memory_plan);
 
                 bool computes_result(Node* node);
+                size_t get_stale_index(const std::string& name);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(CodeWriter& writer,
@@ -284,7 +312,8 @@ namespace ngraph
                 // name of a tensor and index into the cpu_runtime_context's buffer_data vector to
                 // get the tensor
                 std::unordered_map<std::string, size_t> m_buffer_indices;
-                std::unordered_map<std::string, bool> tensor_stale;
+                // name of a tensor and its slot in each context's tensor_stale array
+                std::unordered_map<std::string, size_t> m_stale_indices;
                 // Each tensor is put into one buffer set.
                 // All the tensors in the same buffer set share the same memory buffer.
                 // bufferID_to_tensorSets maps bufferID to the pair of TensorRole and buffer set.
@@ -298,6 +327,11 @@ namespace ngraph
                 std::unordered_map<descriptor::Tensor*, size_t> tensor_to_bufferID;
                 std::unordered_map<std::string, std::string> tensor_alias;
 
+                // Set by set_optimized, the graph passes are skipped
+                bool m_optimized = false;
+                std::shared_ptr<ngraph::Function> m_optimized_function;
+                std::string m_memory_plan;
+
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
                 // and the tensor's offset into the memory allocated for intermediates.
                 // used to calculate the correct address at runtime
@@ -307,10 +341,9 @@ namespace ngraph
                 // used to get the address at runtime
                 std::list<std::pair<size_t, void*>> constant_tensor_data;
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
-                // input index, offset into the input, and if the input is stale
+                // input index, offset into the input, and the slot of the input's stale flag
                 // used to calculate the correct address at runtime
-                std::list<std::tuple<size_t, size_t, size_t, std::reference_wrapper<bool>>>
-                    function_input_index_offset;
+                std::list<std::tuple<size_t, size_t, size_t, size_t>> function_input_index_offset;
                 // index to the cpu_runtime_context's buffer_data vector to get a tensor,
                 // output index, and offset into the output.
                 // used to calculate the correct address at runtime
@@ -320,6 +353,7 @@ namespace ngraph
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
+                std::unique_ptr<runtime::ConcurrentPerformanceCounter[]> m_op_timers;
 
                 /// Map each node with mkldnn implementation to its mkldnn primitive creating
                 /// string, deps, mkldnn primitive index, and mkldnn scratchpad size.
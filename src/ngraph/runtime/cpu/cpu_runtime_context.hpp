@@ -63,7 +63,11 @@ namespace ngraph
             {
                 int64_t* op_durations;
                 bool* p_en;
+                // caching flags of the tensors, indexed by CPU_ExternalFunction stale slot
+                bool* tensor_stale;
                 bool first_iteration;
+                // executor thread pool (and TBB arena) this context runs its kernels on
+                int arena;
                 // stores tensor pointers
                 std::vector<void*> buffer_data;
                 std::vector<mkldnn::memory*> mkldnn_memories;
@@ -0,0 +1,183 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// Elements evaluated per tile, chosen so that every intermediate value of a
+                /// typical chain stays resident in L1/L2
+                constexpr size_t fused_elementwise_tile_size = 1024;
+
+                template <typename ElementType>
+                void fused_elementwise_tile(
+                    const std::vector<void*>& inputs,
+                    ElementType* output,
+                    size_t begin,
+                    size_t n,
+                    const std::vector<ngraph::op::FusedElementwise::Instruction>& program,
+                    ElementType* scratch,
+                    ElementType** values)
+                {
+                    using Opcode = ngraph::op::FusedElementwise::Opcode;
+                    using Vector =
+                        Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>>;
+
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = n;
+                    for (size_t i = 0; i < program.size(); i++)
+                    {
+                        const auto& inst = program[i];
+                        bool last = i + 1 == program.size();
+                        ElementType* dst =
+                            last ? output + begin : scratch + i * fused_elementwise_tile_size;
+                        Vector out(dst, dims);
+                        switch (inst.opcode)
+                        {
+                        case Opcode::Load:
+                            dst = static_cast<ElementType*>(inputs[inst.arg0]) + begin;
+                            if (last)
+                            {
+                                std::copy(dst, dst + n, output + begin);
+                            }
+                            break;
+                        case Opcode::BroadcastLoad:
+                        {
+                            auto in = static_cast<const ElementType*>(inputs[inst.arg0]);
+                            size_t inner = inst.broadcast_inner;
+                            size_t size = inst.broadcast_size;
+                            if (size == 1)
+                            {
+                                std::fill(dst, dst + n, in[0]);
+                                break;
+                            }
+                            // Copy runs of repeated input elements
+                            size_t j = 0;
+                            while (j < n)
+                            {
+                                size_t index = begin + j;
+                                size_t run = std::min(n - j, inner - index % inner);
+                                std::fill(dst + j, dst + j + run, in[(index / inner) % size]);
+                                j += run;
+                            }
+                            break;
+                        }
+                        case Opcode::Add:
+                            out = Vector(values[inst.arg0], dims) + Vector(values[inst.arg1], dims);
+                            break;
+                        case Opcode::Subtract:
+                            out = Vector(values[inst.arg0], dims) - Vector(values[inst.arg1], dims);
+                            break;
+                        case Opcode::Multiply:
+                            out = Vector(values[inst.arg0], dims) * Vector(values[inst.arg1], dims);
+                            break;
+                        case Opcode::Divide:
+                            out = Vector(values[inst.arg0], dims) / Vector(values[inst.arg1], dims);
+                            break;
+                        case Opcode::Maximum:
+                            out = Vector(values[inst.arg0], dims)
+                                      .cwiseMax(Vector(values[inst.arg1], dims));
+                            break;
+                        case Opcode::Minimum:
+                            out = Vector(values[inst.arg0], dims)
+                                      .cwiseMin(Vector(values[inst.arg1], dims));
+                            break;
+                        case Opcode::Negative: out = -Vector(values[inst.arg0], dims); break;
+                        case Opcode::Abs: out = Vector(values[inst.arg0], dims).abs(); break;
+                        case Opcode::Exp: out = Vector(values[inst.arg0], dims).exp(); break;
+                        case Opcode::Log: out = Vector(values[inst.arg0], dims).log(); break;
+                        case Opcode::Sqrt: out = Vector(values[inst.arg0], dims).sqrt(); break;
+                        case Opcode::Tanh: out = Vector(values[inst.arg0], dims).tanh(); break;
+                        case Opcode::Sigmoid:
+                            out = ElementType(1) /
+                                  ((-Vector(values[inst.arg0], dims)).exp() + ElementType(1));
+                            break;
+                        case Opcode::Relu:
+                            out = Vector(values[inst.arg0], dims).cwiseMax(ElementType(0));
+                            break;
+                        }
+                        values[i] = dst;
+                    }
+                }
+
+                /// \brief Evaluates a FusedElementwise program tile by tile, running every
+                ///        instruction on one tile before moving to the next.
+                template <typename ElementType>
+                void fused_elementwise(
+                    const std::vector<void*>& inputs,
+                    void* output,
+                    size_t count,
+                    const std::vector<ngraph::op::FusedElementwise::Instruction>& program,
+                    int arena)
+                {
+                    const size_t tile = fused_elementwise_tile_size;
+                    size_t num_tiles = (count + tile - 1) / tile;
+
+                    auto evaluate_tiles = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<ElementType> scratch(program.size() * tile);
+                        std::vector<ElementType*> values(program.size());
+                        for (Eigen::Index t = first; t < last; t++)
+                        {
+                            size_t begin = t * tile;
+                            fused_elementwise_tile<ElementType>(inputs,
+                                                                static_cast<ElementType*>(output),
+                                                                begin,
+                                                                std::min(tile, count - begin),
+                                                                program,
+                                                                scratch.data(),
+                                                                values.data());
+                        }
+                    };
+
+                    if (num_tiles <= 1)
+                    {
+                        evaluate_tiles(0, num_tiles);
+                        return;
+                    }
+
+                    size_t loads = 0;
+                    for (const auto& inst : program)
+                    {
+                        if (ngraph::op::FusedElementwise::get_arity(inst.opcode) == 0)
+                        {
+                            loads++;
+                        }
+                    }
+                    Eigen::TensorOpCost cost(loads * tile * sizeof(ElementType),
+                                             tile * sizeof(ElementType),
+                                             program.size() * tile);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        num_tiles, cost, evaluate_tiles);
+                }
+            }
+        }
+    }
+}
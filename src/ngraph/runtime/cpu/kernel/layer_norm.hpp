@@ -0,0 +1,151 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// Independent Welford accumulators per row, one per vector lane
+                constexpr size_t layer_norm_lanes = 16;
+
+                // Mean and biased variance of a row in a single pass. Lane k accumulates
+                // elements k, k + lanes, ... so that the updates vectorize; the lanes and the
+                // tail are then merged with Chan's pairwise formula.
+                template <typename ElementType>
+                void layer_norm_moments(const ElementType* x,
+                                        size_t cols,
+                                        ElementType& mean,
+                                        ElementType& variance)
+                {
+                    const size_t lanes = layer_norm_lanes;
+                    size_t blocks = cols / lanes;
+
+                    ElementType lane_mean[lanes] = {};
+                    ElementType lane_m2[lanes] = {};
+                    for (size_t b = 0; b < blocks; b++)
+                    {
+                        const ElementType* block = x + b * lanes;
+                        ElementType inv_count = ElementType(1) / ElementType(b + 1);
+                        for (size_t k = 0; k < lanes; k++)
+                        {
+                            ElementType delta = block[k] - lane_mean[k];
+                            lane_mean[k] += delta * inv_count;
+                            lane_m2[k] += delta * (block[k] - lane_mean[k]);
+                        }
+                    }
+
+                    double count = 0;
+                    double m = 0;
+                    double m2 = 0;
+                    auto merge = [&](double other_count, double other_mean, double other_m2) {
+                        double total = count + other_count;
+                        double delta = other_mean - m;
+                        m += delta * other_count / total;
+                        m2 += other_m2 + delta * delta * count * other_count / total;
+                        count = total;
+                    };
+                    if (blocks > 0)
+                    {
+                        for (size_t k = 0; k < lanes; k++)
+                        {
+                            merge(static_cast<double>(blocks), lane_mean[k], lane_m2[k]);
+                        }
+                    }
+                    for (size_t j = blocks * lanes; j < cols; j++)
+                    {
+                        merge(1, x[j], 0);
+                    }
+
+                    mean = static_cast<ElementType>(m);
+                    variance = static_cast<ElementType>(m2 / static_cast<double>(cols));
+                }
+
+                /// \brief LayerNorm of a rows x cols matrix with rows split over the executor's
+                ///        pool. Each row is read once for its moments and once more, from
+                ///        cache, to normalize it.
+                template <typename ElementType>
+                void layer_norm(const void* input,
+                                const void* scale,
+                                const void* bias,
+                                void* output,
+                                void* mean,
+                                void* variance,
+                                size_t rows,
+                                size_t cols,
+                                double epsilon,
+                                int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input);
+                    auto gamma = static_cast<const ElementType*>(scale);
+                    auto beta = static_cast<const ElementType*>(bias);
+                    auto out = static_cast<ElementType*>(output);
+                    auto row_mean = static_cast<ElementType*>(mean);
+                    auto row_variance = static_cast<ElementType*>(variance);
+
+                    auto normalize_rows = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index row = first; row < last; row++)
+                        {
+                            const ElementType* x = in + row * cols;
+                            ElementType* y = out + row * cols;
+                            ElementType m, var;
+                            layer_norm_moments(x, cols, m, var);
+                            ElementType inv_stddev = static_cast<ElementType>(
+                                1.0 / std::sqrt(static_cast<double>(var) + epsilon));
+                            if (gamma != nullptr)
+                            {
+                                for (size_t j = 0; j < cols; j++)
+                                {
+                                    y[j] = (x[j] - m) * inv_stddev * gamma[j] + beta[j];
+                                }
+                            }
+                            else
+                            {
+                                for (size_t j = 0; j < cols; j++)
+                                {
+                                    y[j] = (x[j] - m) * inv_stddev;
+                                }
+                            }
+                            if (row_mean != nullptr)
+                            {
+                                row_mean[row] = m;
+                                row_variance[row] = var;
+                            }
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(cols * sizeof(ElementType) * (gamma ? 3 : 1),
+                                             cols * sizeof(ElementType),
+                                             cols * 8);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        rows, cost, normalize_rows);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::FusedElementwise::type_info;
+
+op::FusedElementwise::FusedElementwise(const OutputVector& args,
+                                       const vector<Instruction>& program,
+                                       const Shape& shape)
+    : Op(args)
+    , m_program(program)
+    , m_shape(shape)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::FusedElementwise::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, get_input_size() > 0, "FusedElementwise needs an input");
+    NODE_VALIDATION_CHECK(this, !m_program.empty(), "FusedElementwise program is empty");
+
+    auto et = get_input_element_type(0);
+    size_t count = shape_size(m_shape);
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == et,
+                              "FusedElementwise input element types do not match");
+    }
+    for (size_t i = 0; i < m_program.size(); i++)
+    {
+        const Instruction& inst = m_program[i];
+        switch (inst.opcode)
+        {
+        case Opcode::Load:
+            NODE_VALIDATION_CHECK(this,
+                                  inst.arg0 < get_input_size() &&
+                                      shape_size(get_input_shape(inst.arg0)) == count,
+                                  "FusedElementwise load ",
+                                  i,
+                                  " does not match the output size");
+            break;
+        case Opcode::BroadcastLoad:
+            NODE_VALIDATION_CHECK(this,
+                                  inst.arg0 < get_input_size() && inst.broadcast_inner > 0 &&
+                                      shape_size(get_input_shape(inst.arg0)) ==
+                                          inst.broadcast_size,
+                                  "FusedElementwise broadcast load ",
+                                  i,
+                                  " does not match its input");
+            break;
+        default:
+            NODE_VALIDATION_CHECK(this,
+                                  inst.arg0 < i && (get_arity(inst.opcode) < 2 || inst.arg1 < i),
+                                  "FusedElementwise instruction ",
+                                  i,
+                                  " reads a value that is not computed before it");
+            break;
+        }
+    }
+
+    set_output_type(0, et, m_shape);
+}
+
+shared_ptr<Node> op::FusedElementwise::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<FusedElementwise>(new_args, m_program, m_shape);
+}
+
+size_t op::FusedElementwise::get_arity(Opcode opcode)
+{
+    switch (opcode)
+    {
+    case Opcode::Load:
+    case Opcode::BroadcastLoad: return 0;
+    case Opcode::Add:
+    case Opcode::Subtract:
+    case Opcode::Multiply:
+    case Opcode::Divide:
+    case Opcode::Maximum:
+    case Opcode::Minimum: return 2;
+    case Opcode::Negative:
+    case Opcode::Abs:
+    case Opcode::Exp:
+    case Opcode::Log:
+    case Opcode::Sqrt:
+    case Opcode::Tanh:
+    case Opcode::Sigmoid:
+    case Opcode::Relu: return 1;
+    }
+    return 0;
+}
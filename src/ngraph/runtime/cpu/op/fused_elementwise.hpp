@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A chain of elementwise operations evaluated in a single pass over its output.
+        ///
+        /// The chain is a straight-line program over values the size of the output. Instruction
+        /// i produces value i from its inputs and earlier values; the last instruction produces
+        /// the result. Inputs are either the same shape as the output (Load) or broadcast to it
+        /// along leading and trailing axes (BroadcastLoad).
+        class FusedElementwise : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"FusedElementwise", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            enum class Opcode
+            {
+                Load,
+                BroadcastLoad,
+                Add,
+                Subtract,
+                Multiply,
+                Divide,
+                Maximum,
+                Minimum,
+                Negative,
+                Abs,
+                Exp,
+                Log,
+                Sqrt,
+                Tanh,
+                Sigmoid,
+                Relu
+            };
+
+            struct Instruction
+            {
+                Opcode opcode;
+                /// Input index for loads, earlier value indices for computations
+                size_t arg0;
+                size_t arg1;
+                /// For BroadcastLoad, output element j reads input element
+                /// (j / broadcast_inner) % broadcast_size
+                size_t broadcast_inner;
+                size_t broadcast_size;
+            };
+
+            /// \brief Constructs a FusedElementwise operation.
+            ///
+            /// \param args The inputs referenced by the program's loads.
+            /// \param program The instructions, the last of which produces the result.
+            /// \param shape The output shape.
+            CPU_BACKEND_API FusedElementwise(const OutputVector& args,
+                                             const std::vector<Instruction>& program,
+                                             const Shape& shape);
+            void validate_and_infer_types() override;
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            const std::vector<Instruction>& get_program() const { return m_program; }
+            /// \brief Number of inputs an opcode reads, 0 for loads
+            static size_t get_arity(Opcode opcode);
+
+        private:
+            std::vector<Instruction> m_program;
+            Shape m_shape;
+        };
+    }
+}
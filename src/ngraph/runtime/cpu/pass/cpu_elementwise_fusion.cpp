@@ -0,0 +1,326 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "cpu_elementwise_fusion.hpp"
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Opcode = op::FusedElementwise::Opcode;
+
+// Opcode computing an elementwise node, Load if the node is not a fusable computation
+static Opcode get_opcode(const Node* node)
+{
+    if (node->get_autob().m_type != op::AutoBroadcastType::NONE)
+    {
+        return Opcode::Load;
+    }
+    if (is_type<op::Add>(node))
+    {
+        return Opcode::Add;
+    }
+    if (is_type<op::Subtract>(node))
+    {
+        return Opcode::Subtract;
+    }
+    if (is_type<op::Multiply>(node))
+    {
+        return Opcode::Multiply;
+    }
+    if (is_type<op::Divide>(node))
+    {
+        return Opcode::Divide;
+    }
+    if (is_type<op::Maximum>(node))
+    {
+        return Opcode::Maximum;
+    }
+    if (is_type<op::Minimum>(node))
+    {
+        return Opcode::Minimum;
+    }
+    if (is_type<op::Negative>(node))
+    {
+        return Opcode::Negative;
+    }
+    if (is_type<op::Abs>(node))
+    {
+        return Opcode::Abs;
+    }
+    if (is_type<op::Exp>(node))
+    {
+        return Opcode::Exp;
+    }
+    if (is_type<op::Log>(node))
+    {
+        return Opcode::Log;
+    }
+    if (is_type<op::Sqrt>(node))
+    {
+        return Opcode::Sqrt;
+    }
+    if (is_type<op::Tanh>(node))
+    {
+        return Opcode::Tanh;
+    }
+    if (is_type<op::Sigmoid>(node))
+    {
+        return Opcode::Sigmoid;
+    }
+    if (is_type<op::Relu>(node))
+    {
+        return Opcode::Relu;
+    }
+    return Opcode::Load;
+}
+
+// Output element j of a broadcast reads input element (j / inner) % size when the axes that
+// are not broadcast are contiguous
+static bool get_broadcast_pattern(const op::Broadcast* broadcast, size_t& inner, size_t& size)
+{
+    const Shape& out_shape = broadcast->get_shape();
+    const AxisSet& axes = broadcast->get_broadcast_axes();
+    size_t first_kept = out_shape.size();
+    size_t last_kept = 0;
+    for (size_t i = 0; i < out_shape.size(); i++)
+    {
+        if (axes.count(i) == 0)
+        {
+            first_kept = min(first_kept, i);
+            last_kept = i + 1;
+        }
+    }
+    for (size_t i = first_kept; i < last_kept; i++)
+    {
+        if (axes.count(i) != 0)
+        {
+            return false;
+        }
+    }
+    size = shape_size(broadcast->get_input_shape(0));
+    inner = 1;
+    for (size_t i = max(first_kept, last_kept); i < out_shape.size(); i++)
+    {
+        inner *= out_shape[i];
+    }
+    return true;
+}
+
+static bool is_fusable(const shared_ptr<Node>& node, const element::Type& et, size_t count)
+{
+    if (node->get_output_size() != 1 || node->get_element_type() != et ||
+        shape_size(node->get_shape()) != count || !node->get_control_dependencies().empty() ||
+        !node->get_control_dependents().empty())
+    {
+        return false;
+    }
+    if (auto broadcast = as_type_ptr<op::Broadcast>(node))
+    {
+        size_t inner, size;
+        return get_broadcast_pattern(broadcast.get(), inner, size);
+    }
+    if (auto reshape = as_type_ptr<op::Reshape>(node))
+    {
+        return !reshape->get_is_transpose();
+    }
+    return get_opcode(node.get()) != Opcode::Load;
+}
+
+// Builds and installs the fused op for the chain ending at root, returns false if the chain is
+// too small to be worth fusing
+static bool fuse_chain(const shared_ptr<Node>& root,
+                       const unordered_map<Node*, size_t>& topological_index,
+                       unordered_set<Node*>& fused_nodes)
+{
+    auto et = root->get_element_type();
+    size_t count = shape_size(root->get_shape());
+
+    // Grow the chain from the latest candidate backwards, so that by the time a producer is
+    // considered every one of its users that can join the chain already has
+    unordered_set<Node*> in_chain{root.get()};
+    NodeVector members{root};
+    priority_queue<pair<size_t, shared_ptr<Node>>> candidates;
+    unordered_set<Node*> seen{root.get()};
+    auto add_producers = [&](const shared_ptr<Node>& node) {
+        if (is_type<op::Broadcast>(node))
+        {
+            return;
+        }
+        for (auto& value : node->input_values())
+        {
+            auto producer = value.get_node_shared_ptr();
+            if (seen.insert(producer.get()).second)
+            {
+                candidates.push(make_pair(topological_index.at(producer.get()), producer));
+            }
+        }
+    };
+    add_producers(root);
+    while (!candidates.empty())
+    {
+        auto candidate = candidates.top().second;
+        candidates.pop();
+        if (fused_nodes.count(candidate.get()) != 0 || !is_fusable(candidate, et, count))
+        {
+            continue;
+        }
+        bool internal = true;
+        for (auto& user : candidate->get_users())
+        {
+            if (in_chain.count(user.get()) == 0)
+            {
+                internal = false;
+                break;
+            }
+        }
+        if (internal)
+        {
+            in_chain.insert(candidate.get());
+            members.push_back(candidate);
+            add_producers(candidate);
+        }
+    }
+
+    sort(members.begin(), members.end(), [&](const shared_ptr<Node>& a, const shared_ptr<Node>& b) {
+        return topological_index.at(a.get()) < topological_index.at(b.get());
+    });
+
+    OutputVector args;
+    map<Output<Node>, size_t> arg_index;
+    map<Output<Node>, size_t> value_index;
+    vector<op::FusedElementwise::Instruction> program;
+    size_t computations = 0;
+    bool has_variable_arg = false;
+
+    auto get_arg = [&](const Output<Node>& value) {
+        auto it = arg_index.find(value);
+        if (it != arg_index.end())
+        {
+            return it->second;
+        }
+        has_variable_arg |= !is_type<op::Constant>(value.get_node());
+        arg_index[value] = args.size();
+        args.push_back(value);
+        return args.size() - 1;
+    };
+    auto get_value = [&](const Output<Node>& value) {
+        auto it = value_index.find(value);
+        if (it != value_index.end())
+        {
+            return it->second;
+        }
+        program.push_back({Opcode::Load, get_arg(value), 0, 1, 1});
+        value_index[value] = program.size() - 1;
+        return program.size() - 1;
+    };
+
+    for (auto& member : members)
+    {
+        Output<Node> result = member->output(0);
+        if (auto broadcast = as_type_ptr<op::Broadcast>(member))
+        {
+            size_t inner, size;
+            get_broadcast_pattern(broadcast.get(), inner, size);
+            program.push_back(
+                {Opcode::BroadcastLoad, get_arg(broadcast->input_value(0)), 0, inner, size});
+            computations++;
+        }
+        else if (is_type<op::Reshape>(member))
+        {
+            // A reshape that does not transpose leaves the elements in place
+            value_index[result] = get_value(member->input_value(0));
+            continue;
+        }
+        else
+        {
+            size_t arg0 = get_value(member->input_value(0));
+            size_t arg1 = member->get_input_size() > 1 ? get_value(member->input_value(1)) : 0;
+            program.push_back({get_opcode(member.get()), arg0, arg1, 1, 1});
+            computations++;
+        }
+        value_index[result] = program.size() - 1;
+    }
+
+    // Chains of constants are left for constant folding
+    if (computations < 2 || !has_variable_arg)
+    {
+        return false;
+    }
+
+    NGRAPH_DEBUG << "Fusing " << members.size() << " elementwise ops ending at "
+                 << root->get_name();
+    auto fused = make_shared<op::FusedElementwise>(args, program, root->get_shape());
+    replace_node(root, fused);
+    for (auto& member : members)
+    {
+        fused_nodes.insert(member.get());
+    }
+    return true;
+}
+
+bool runtime::cpu::pass::CPUElementwiseFusion::run_on_function(shared_ptr<Function> f)
+{
+    auto ops = f->get_ordered_ops();
+    unordered_map<Node*, size_t> topological_index;
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        topological_index[ops[i].get()] = i;
+    }
+
+    bool replaced = false;
+    unordered_set<Node*> fused_nodes;
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it)
+    {
+        auto& node = *it;
+        if (fused_nodes.count(node.get()) != 0 || get_opcode(node.get()) == Opcode::Load)
+        {
+            continue;
+        }
+        auto et = node->get_element_type();
+        if ((et != element::f32 && et != element::f64) ||
+            !is_fusable(node, et, shape_size(node->get_shape())))
+        {
+            continue;
+        }
+        replaced |= fuse_chain(node, topological_index, fused_nodes);
+    }
+    return replaced;
+}
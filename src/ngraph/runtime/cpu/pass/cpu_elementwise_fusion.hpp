@@ -0,0 +1,46 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces maximal chains of floating point elementwise ops, together
+                ///        with the broadcasts and non-transposing reshapes feeding them, with a
+                ///        single FusedElementwise op.
+                ///
+                /// A chain grows backwards from its root through producers whose every user is
+                /// already in the chain, so intermediate values are never needed outside of it.
+                /// Broadcasts are only fused when their kept axes are contiguous; anything else
+                /// becomes an input of the chain and is evaluated as before.
+                class CPU_BACKEND_API CPUElementwiseFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
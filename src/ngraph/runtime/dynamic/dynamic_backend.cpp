@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
+#include <algorithm>
+#include <cstring>
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/broadcast.hpp"
@@ -72,15 +74,88 @@ shared_ptr<runtime::Executable>
                                               bool enable_performance_collection)
 {
     return make_shared<runtime::dynamic::DynamicExecutable>(
-        function, m_wrapped_backend, enable_performance_collection);
+        function, m_wrapped_backend, enable_performance_collection, m_shape_bucketing);
+}
+
+// parse_string<size_t> wraps a leading minus sign around to a huge extent, so reject it up front
+static size_t parse_extent(const string& s)
+{
+    if (s.find('-') != string::npos)
+    {
+        throw std::runtime_error("Expected a non-negative extent, got '" + s + "'");
+    }
+    return parse_string<size_t>(s);
+}
+
+bool runtime::dynamic::DynamicBackend::set_config(const map<string, string>& config,
+                                                  string& error)
+{
+    map<string, string> wrapped_config;
+    ShapeBucketing shape_bucketing = m_shape_bucketing;
+    error = "";
+    try
+    {
+        for (auto& kv : config)
+        {
+            if (kv.first == "shape_bucket_axis")
+            {
+                shape_bucketing.axis = parse_extent(kv.second);
+            }
+            else if (kv.first == "shape_buckets")
+            {
+                shape_bucketing.buckets.clear();
+                for (auto& bucket : split(kv.second, ',', true))
+                {
+                    if (!bucket.empty())
+                    {
+                        shape_bucketing.buckets.push_back(parse_extent(bucket));
+                    }
+                }
+            }
+            else
+            {
+                wrapped_config.insert(kv);
+            }
+        }
+    }
+    catch (const std::runtime_error& e)
+    {
+        error = e.what();
+        return false;
+    }
+
+    for (size_t i = 1; i < shape_bucketing.buckets.size(); i++)
+    {
+        if (shape_bucketing.buckets[i - 1] >= shape_bucketing.buckets[i])
+        {
+            error = "shape_buckets must be strictly ascending";
+            return false;
+        }
+    }
+
+    // Only commit the bucketing once the wrapped backend has accepted the rest of the config
+    if (!wrapped_config.empty() && !m_wrapped_backend->set_config(wrapped_config, error))
+    {
+        return false;
+    }
+    m_shape_bucketing = shape_bucketing;
+    return true;
+}
+
+size_t runtime::dynamic::ShapeBucketing::get_bucket(size_t extent) const
+{
+    auto it = std::lower_bound(buckets.begin(), buckets.end(), extent);
+    return it == buckets.end() ? extent : *it;
 }
 
 runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrapped_function,
                                                        shared_ptr<runtime::Backend> wrapped_backend,
-                                                       bool enable_performance_collection)
+                                                       bool enable_performance_collection,
+                                                       const ShapeBucketing& shape_bucketing)
     : m_wrapped_function(wrapped_function)
     , m_wrapped_backend(wrapped_backend)
     , m_enable_performance_collection(enable_performance_collection)
+    , m_shape_bucketing(shape_bucketing)
 {
     pass::Manager passes;
     passes.register_pass<pass::ShapeRelevance>();
@@ -116,17 +191,168 @@ static size_t count_dyn_nodes(const shared_ptr<ngraph::Function>& f)
     return count;
 }
 
+// Copies the leading min(src_shape[axis], dst_shape[axis]) rows along axis from src to dst.
+// Both buffers are dense row-major and the shapes may differ only at axis.
+static void copy_along_axis(const char* src,
+                            const Shape& src_shape,
+                            char* dst,
+                            const Shape& dst_shape,
+                            size_t axis,
+                            size_t element_size)
+{
+    size_t outer = 1;
+    for (size_t i = 0; i < axis; i++)
+    {
+        outer *= src_shape[i];
+    }
+    size_t inner_bytes = element_size;
+    for (size_t i = axis + 1; i < src_shape.size(); i++)
+    {
+        inner_bytes *= src_shape[i];
+    }
+    size_t src_stride = src_shape[axis] * inner_bytes;
+    size_t dst_stride = dst_shape[axis] * inner_bytes;
+    size_t copy_bytes = std::min(src_stride, dst_stride);
+    for (size_t i = 0; i < outer; i++)
+    {
+        std::memcpy(dst + i * dst_stride, src + i * src_stride, copy_bytes);
+    }
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_bucketable_extent(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
+    if (!m_shape_bucketing.is_enabled())
+    {
+        return 0;
+    }
+
+    size_t axis = m_shape_bucketing.axis;
+    size_t extent = 0;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
+        {
+            continue;
+        }
+        const Shape& shape = inputs[i]->get_shape();
+        if (shape.size() <= axis)
+        {
+            continue;
+        }
+        if (extent == 0)
+        {
+            extent = shape[axis];
+        }
+        else if (shape[axis] != extent)
+        {
+            return 0;
+        }
+    }
+    return extent;
+}
+
 bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    // TODO: Get cached executable out if it exists.
+    NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
+
+    size_t extent = get_bucketable_extent(inputs);
+    size_t bucket = (extent == 0 ? 0 : m_shape_bucketing.get_bucket(extent));
+    if (bucket == extent)
+    {
+        return call_specialized(outputs, inputs);
+    }
+
+    size_t axis = m_shape_bucketing.axis;
+    std::vector<std::shared_ptr<runtime::Tensor>> padded_inputs;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        auto& input = inputs[i];
+        const Shape& shape = input->get_shape();
+        if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes() ||
+            shape.size() <= axis)
+        {
+            padded_inputs.push_back(input);
+            continue;
+        }
+
+        Shape padded_shape = shape;
+        padded_shape[axis] = bucket;
+        const element::Type& element_type = input->get_element_type();
+        std::vector<char> data(input->get_size_in_bytes());
+        input->read(data.data(), data.size());
+        std::vector<char> padded_data(shape_size(padded_shape) * element_type.size(), 0);
+        copy_along_axis(
+            data.data(), shape, padded_data.data(), padded_shape, axis, element_type.size());
+
+        auto padded_input = m_wrapped_backend->create_tensor(element_type, padded_shape);
+        padded_input->write(padded_data.data(), padded_data.size());
+        padded_inputs.push_back(padded_input);
+    }
+
+    std::vector<std::shared_ptr<runtime::Tensor>> padded_outputs;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        padded_outputs.push_back(make_shared<DynamicTensor>(
+            outputs[i]->get_element_type(), PartialShape::dynamic(), m_wrapped_backend));
+    }
+
+    bool rc = call_specialized(padded_outputs, padded_inputs);
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        auto& padded_output = padded_outputs[i];
+        const Shape& padded_shape = padded_output->get_shape();
+        NGRAPH_CHECK(padded_shape.size() > axis && padded_shape[axis] == bucket,
+                     "Shape bucketing on axis ",
+                     axis,
+                     " requires every output to carry the bucketed axis, but output ",
+                     i,
+                     " has shape ",
+                     padded_shape);
+
+        Shape shape = padded_shape;
+        shape[axis] = extent;
+        const element::Type& element_type = padded_output->get_element_type();
+        if (auto dynamic_tensor =
+                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
+        {
+            dynamic_tensor->make_storage(element_type, shape);
+        }
+        else
+        {
+            NGRAPH_CHECK(outputs[i]->get_shape() == shape,
+                         "Output ",
+                         i,
+                         " has shape ",
+                         outputs[i]->get_shape(),
+                         " but the call produced ",
+                         shape);
+        }
+
+        std::vector<char> padded_data(padded_output->get_size_in_bytes());
+        padded_output->read(padded_data.data(), padded_data.size());
+        std::vector<char> data(shape_size(shape) * element_type.size());
+        copy_along_axis(
+            padded_data.data(), padded_shape, data.data(), shape, axis, element_type.size());
+        outputs[i]->write(data.data(), data.size());
+    }
+
+    return rc;
+}
+
+bool runtime::dynamic::DynamicExecutable::call_specialized(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
+    // Get cached executable out if it exists.
     // We will cache on:
     // (1) all shapes;
     // (2) all values of shape-relevant input tensors.
 
     std::vector<int> merged_input_shapes;
-    std::ostringstream key;
     size_t loop_count = 0;
     for (auto& input : inputs)
     {
@@ -156,16 +382,27 @@ bool runtime::dynamic::DynamicExecutable::call(
         loop_count++;
     }
 
-    std::copy(merged_input_shapes.begin(),
-              merged_input_shapes.end(),
-              std::ostream_iterator<int>(key, ", "));
-
-    if (m_lru->is_cached(merged_input_shapes))
+    std::shared_ptr<runtime::Executable> cached_executable;
+    std::shared_ptr<Function> clone;
+    if (m_lru->lookup(merged_input_shapes, cached_executable, clone))
     {
         std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
         std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
 
-        std::shared_ptr<Function> clone = m_lru->get_cloned_function(merged_input_shapes);
+        for (auto& input : inputs)
+        {
+            if (auto dynamic_tensor =
+                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
+            {
+                NGRAPH_CHECK(dynamic_tensor->has_storage());
+                wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
+            }
+            else
+            {
+                wrapped_inputs.push_back(input);
+            }
+        }
+
         const ResultVector& results = clone->get_results();
         for (auto& result : results)
         {
@@ -190,7 +427,7 @@ bool runtime::dynamic::DynamicExecutable::call(
             }
         }
 
-        return m_lru->get_cached_entry(merged_input_shapes)->call(wrapped_outputs, inputs);
+        return cached_executable->call(wrapped_outputs, wrapped_inputs);
     }
     else
     {
@@ -200,7 +437,6 @@ bool runtime::dynamic::DynamicExecutable::call(
         std::vector<element::Type> arg_element_types;
         std::vector<PartialShape> arg_shapes;
 
-        std::shared_ptr<Function> clone;
         {
             // We'll use AlignedBuffers to back the base pointers, storing them in this vector for
             // RAII
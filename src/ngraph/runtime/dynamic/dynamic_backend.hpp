@@ -35,10 +35,33 @@ namespace ngraph
             class DynamicBackend;
             class DynamicExecutable;
             class DynamicTensor;
+            struct ShapeBucketing;
         }
     }
 }
 
+///
+/// \brief Opt-in policy that rounds one axis of the call shapes up to a fixed set of buckets so
+///        that a handful of compiled specializations cover a long tail of input shapes.
+///
+/// When enabled, every non-shape-relevant input whose rank exceeds `axis` is zero-padded along
+/// `axis` up to the smallest bucket that fits, the padded specialization is executed, and every
+/// output is sliced back along `axis`. This is only correct for functions whose rows along
+/// `axis` are computed independently of each other (e.g. a batch axis) and whose outputs all
+/// carry that axis. Calls whose data inputs disagree on the extent of `axis`, or whose extent
+/// exceeds the largest bucket, are compiled for their exact shapes.
+///
+struct ngraph::runtime::dynamic::ShapeBucketing
+{
+    size_t axis = 0;
+    /// Bucket extents in ascending order; empty disables bucketing.
+    std::vector<size_t> buckets;
+
+    bool is_enabled() const { return !buckets.empty(); }
+    /// \returns the smallest bucket not less than `extent`, or `extent` itself if none fits.
+    size_t get_bucket(size_t extent) const;
+};
+
 ///
 /// \brief Wrapper class used to provide dynamic tensor support on backends
 ///        that otherwise do not support dynamic tensors.
@@ -52,6 +75,10 @@ namespace ngraph
 /// * `compile` will return a special `DynamicExecutable` object, which allows
 ///   dynamic shapes to be supported via graph cloning.
 ///
+/// `set_config` accepts `shape_bucket_axis` and `shape_buckets` (a comma-separated ascending
+/// list of extents) to enable `ShapeBucketing` for executables compiled afterwards. All other
+/// keys are forwarded to the wrapped backend.
+///
 /// This class is instantiated by `ngraph::runtime::Backend::create`.
 ///
 class ngraph::runtime::dynamic::DynamicBackend : public Backend
@@ -73,8 +100,14 @@ public:
     std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
                                         bool enable_performance_data = false) override;
 
+    bool set_config(const std::map<std::string, std::string>& config,
+                    std::string& error) override;
+
+    const ShapeBucketing& get_shape_bucketing() const { return m_shape_bucketing; }
+
 private:
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    ShapeBucketing m_shape_bucketing;
 };
 
 ///
@@ -89,6 +122,9 @@ private:
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// If a `ShapeBucketing` policy is set, the inputs are padded to their bucket before step 1
+/// and the outputs are sliced back afterwards, so that the cache is keyed on bucketed shapes.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
 class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
@@ -96,16 +132,33 @@ class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Exec
 public:
     DynamicExecutable(std::shared_ptr<Function> wrapped_function,
                       std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
-                      bool enable_performance_collection = false);
+                      bool enable_performance_collection = false,
+                      const ShapeBucketing& shape_bucketing = ShapeBucketing());
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    /// \brief Number of calls served by a previously compiled specialization.
+    size_t get_cache_hit_count() const { return m_lru->get_hit_count(); }
+    /// \brief Number of calls that had to specialize and compile the wrapped function.
+    size_t get_cache_miss_count() const { return m_lru->get_miss_count(); }
+    /// \brief Number of compiled specializations dropped to stay within the cache limits.
+    size_t get_cache_eviction_count() const { return m_lru->get_eviction_count(); }
+    /// \brief The cache of compiled specializations, keyed on merged input shapes.
+    const std::shared_ptr<ngraph::runtime::LRUCache>& get_cache() const { return m_lru; }
+
 private:
+    bool call_specialized(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+    /// \returns the extent shared by all data inputs along the bucketed axis, or 0 if the call
+    ///          cannot be bucketed.
+    size_t get_bucketable_extent(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     std::shared_ptr<ngraph::runtime::LRUCache> m_lru =
         std::make_shared<ngraph::runtime::LRUCache>();
     bool m_enable_performance_collection;
+    ShapeBucketing m_shape_bucketing;
 };
 
 ///
@@ -19,6 +19,7 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/executable.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -39,6 +40,87 @@ bool runtime::Executable::call_with_validate(const vector<shared_ptr<runtime::Te
     return call(outputs, inputs);
 }
 
+future<bool> runtime::Executable::async_call(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    function<void(bool)> callback)
+{
+    return submit_async_call(outputs, inputs, move(callback), true);
+}
+
+future<bool> runtime::Executable::submit_async_call(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    function<void(bool)> callback,
+    bool serialize)
+{
+    auto task = make_shared<packaged_task<bool()>>([this, outputs, inputs, callback]() {
+        bool rc = false;
+        try
+        {
+            for (auto& input : inputs)
+            {
+                input->wait_for_read_ready();
+            }
+            rc = call(outputs, inputs);
+            for (auto& output : outputs)
+            {
+                output->wait_for_write_ready();
+            }
+        }
+        catch (...)
+        {
+            if (callback)
+            {
+                callback(false);
+            }
+            throw;
+        }
+        if (callback)
+        {
+            callback(rc);
+        }
+        return rc;
+    });
+    future<bool> result = task->get_future();
+
+    if (!serialize)
+    {
+        ThreadPool::get_async_pool().submit([task]() { (*task)(); });
+    }
+    else
+    {
+        shared_ptr<AsyncQueue> queue = m_async_queue;
+        lock_guard<mutex> lock(queue->mutex);
+        queue->tasks.push_back([task]() { (*task)(); });
+        if (!queue->draining)
+        {
+            queue->draining = true;
+            ThreadPool::get_async_pool().submit([queue]() { drain_async_queue(queue); });
+        }
+    }
+    return result;
+}
+
+void runtime::Executable::drain_async_queue(const shared_ptr<AsyncQueue>& queue)
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            lock_guard<mutex> lock(queue->mutex);
+            if (queue->tasks.empty())
+            {
+                queue->draining = false;
+                return;
+            }
+            task = move(queue->tasks.front());
+            queue->tasks.pop_front();
+        }
+        task();
+    }
+}
+
 void runtime::Executable::validate(const vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                    const vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -126,6 +208,11 @@ vector<runtime::PerformanceCounter> runtime::Executable::get_performance_data()
     return vector<PerformanceCounter>();
 }
 
+runtime::PerformanceCounter runtime::Executable::get_call_performance_data() const
+{
+    return PerformanceCounter(nullptr, 0, 0);
+}
+
 void runtime::Executable::save(std::ostream& /* output_stream */)
 {
     throw runtime_error("save operation unimplemented.");
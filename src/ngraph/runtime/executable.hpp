@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -51,10 +55,34 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Starts a single iteration of a Function without blocking the caller.
+    ///
+    /// The call runs on the process-wide ThreadPool::get_async_pool(), so any number of calls
+    /// may be in flight without dedicating a thread to each. Inputs are waited on with
+    /// wait_for_read_ready before the call and outputs are notified with wait_for_write_ready
+    /// after it. The Executable and all tensors must outlive the call. The default
+    /// implementation runs the calls of one Executable one at a time in submission order;
+    /// backends whose call() is reentrant override this to run them concurrently.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \param callback Optional function invoked on the worker thread when the call completes.
+    ///     It receives false if the call failed or threw, in which case the exception is
+    ///     rethrown by the returned future.
+    /// \returns a future holding the value returned by call()
+    virtual std::future<bool>
+        async_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                   std::function<void(bool)> callback = nullptr);
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
 
+    /// \brief Collect the wall time of whole calls, gathered along with get_performance_data.
+    /// \returns A PerformanceCounter without a node, with no calls if the backend does not
+    ///     time calls.
+    virtual PerformanceCounter get_call_performance_data() const;
+
     /// \brief Validates a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
@@ -157,6 +185,29 @@ protected:
     /// \param func The function with Results fully resolved.
     void set_parameters_and_results(const Function& func);
 
+    /// \brief Queues call() on the async thread pool.
+    /// \param serialize If true, calls on this Executable are run one at a time in submission
+    ///     order without blocking a worker thread while waiting.
+    std::future<bool>
+        submit_async_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                          std::function<void(bool)> callback,
+                          bool serialize);
+
     ngraph::ParameterVector m_parameters;
     ngraph::ResultVector m_results;
+
+private:
+    /// Serialized async calls waiting to run. Held by shared_ptr so that a drain job still
+    /// running on the pool after the last future is ready never touches a destroyed Executable.
+    struct AsyncQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+        bool draining = false;
+    };
+
+    static void drain_async_queue(const std::shared_ptr<AsyncQueue>& queue);
+
+    std::shared_ptr<AsyncQueue> m_async_queue = std::make_shared<AsyncQueue>();
 };
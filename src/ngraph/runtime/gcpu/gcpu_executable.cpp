@@ -138,6 +138,8 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         case ngraph::runtime::interpreter::OP_TYPEID::Dequantize:
         case ngraph::runtime::interpreter::OP_TYPEID::ArgMin:
         case ngraph::runtime::interpreter::OP_TYPEID::ArgMax:
+        case ngraph::runtime::interpreter::OP_TYPEID::NonMaxSuppression_v1:
+        case ngraph::runtime::interpreter::OP_TYPEID::NonMaxSuppression_v3:
             type = op->get_input_element_type(0);
             break;
         case ngraph::runtime::interpreter::OP_TYPEID::Equal:
@@ -160,9 +162,10 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
 #pragma GCC diagnostic pop
 #endif
 
+        chrono::high_resolution_clock::time_point start;
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].start();
+            start = chrono::high_resolution_clock::now();
         }
         if (!op->evaluate(op_outputs, op_inputs))
         {
@@ -170,7 +173,7 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         }
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].stop();
+            record_op_time(op, chrono::high_resolution_clock::now() - start);
         }
     }
 
@@ -26,6 +26,7 @@
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
 #include "ngraph/pass/opset1_downgrade.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
@@ -59,6 +60,12 @@ runtime::interpreter::OP_TYPEID runtime::interpreter::INTExecutable::get_typeid(
     return rc;
 }
 
+// Ops whose kernels keep per-executable state across calls
+static bool is_stateful(const Node& node)
+{
+    return is_type<op::GenerateMask>(&node) || is_type<op::RandomUniform>(&node);
+}
+
 runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& function,
                                                    bool enable_performance_collection)
     : m_is_compiled{true}
@@ -75,6 +82,7 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         bool retval = false;
         switch (INTExecutable::get_typeid(node))
         {
+        case OP_TYPEID::LayerNorm:
         case OP_TYPEID::Squeeze:
         case OP_TYPEID::Unsqueeze: retval = true; break;
         default: break;
@@ -92,8 +100,10 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
+        m_has_stateful_ops |= is_stateful(*node);
     }
     set_parameters_and_results(*m_function);
+    plan_memory();
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
@@ -104,8 +114,179 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
+        m_has_stateful_ops |= is_stateful(*node);
     }
     set_parameters_and_results(*m_function);
+    plan_memory();
+}
+
+void runtime::interpreter::INTExecutable::plan_memory()
+{
+    for (auto op : m_nodes)
+    {
+        for (size_t i = 0; i < op->get_output_size(); ++i)
+        {
+            if (op->get_output_partial_shape(i).is_dynamic() ||
+                op->get_output_element_type(i).is_dynamic())
+            {
+                return;
+            }
+        }
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
+    pass_manager.run_passes(m_function);
+    m_arena_size = m_function->get_temporary_pool_size();
+
+    unordered_map<descriptor::Tensor*, size_t> slot_map;
+    auto add_slot = [&](descriptor::Tensor* tensor, SlotKind kind, const void* data) {
+        slot_map.insert({tensor, m_slots.size()});
+        m_slots.push_back(Slot{kind,
+                               tensor->get_element_type(),
+                               tensor->get_shape(),
+                               kind == SlotKind::Arena ? tensor->get_pool_offset() : 0,
+                               data});
+    };
+
+    size_t input_count = 0;
+    for (auto param : get_parameters())
+    {
+        for (size_t i = 0; i < param->get_output_size(); ++i)
+        {
+            add_slot(&param->output(i).get_tensor(), SlotKind::Parameter, nullptr);
+            m_slots.back().m_offset = input_count++;
+        }
+    }
+    m_parameter_uses.resize(input_count);
+    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    {
+        auto output = get_results()[output_count];
+        if (!is_type<op::Result>(output))
+        {
+            throw ngraph_error("One of function's outputs isn't op::Result");
+        }
+        add_slot(&output->get_output_tensor(0), SlotKind::Result, nullptr);
+        m_slots.back().m_offset = output_count;
+    }
+    m_result_uses.resize(get_results().size());
+
+    for (auto op : m_nodes)
+    {
+        if (op->is_parameter())
+        {
+            continue;
+        }
+        if (auto constant = as_type_ptr<op::Constant>(op))
+        {
+            // Constants are bound straight to their data and never executed
+            add_slot(&constant->output(0).get_tensor(),
+                     SlotKind::Constant,
+                     constant->get_data_ptr());
+            continue;
+        }
+
+        PlannedOp planned{op, get_dispatch_type(*op), {}, {}};
+        size_t op_index = m_planned_ops.size();
+        for (auto input : op->inputs())
+        {
+            size_t slot = slot_map.at(&input.get_tensor());
+            if (m_slots[slot].m_kind == SlotKind::Parameter)
+            {
+                m_parameter_uses[m_slots[slot].m_offset].push_back(
+                    {op_index, planned.m_input_slots.size()});
+            }
+            planned.m_input_slots.push_back(slot);
+        }
+        for (size_t i = 0; i < op->get_output_size(); ++i)
+        {
+            descriptor::Tensor* tensor = &op->output(i).get_tensor();
+            auto it = slot_map.find(tensor);
+            if (it == slot_map.end())
+            {
+                add_slot(tensor, SlotKind::Arena, nullptr);
+                it = slot_map.find(tensor);
+            }
+            size_t slot = it->second;
+            if (m_slots[slot].m_kind == SlotKind::Result)
+            {
+                m_result_uses[m_slots[slot].m_offset].push_back(
+                    {op_index, planned.m_output_slots.size()});
+            }
+            planned.m_output_slots.push_back(slot);
+        }
+        m_planned_ops.push_back(move(planned));
+    }
+    m_is_planned = true;
+}
+
+unique_ptr<runtime::interpreter::INTExecutable::CallFrame>
+    runtime::interpreter::INTExecutable::acquire_call_frame()
+{
+    {
+        lock_guard<mutex> lock(m_frame_mutex);
+        if (!m_free_frames.empty())
+        {
+            unique_ptr<CallFrame> frame = move(m_free_frames.back());
+            m_free_frames.pop_back();
+            return frame;
+        }
+    }
+
+    unique_ptr<CallFrame> frame(new CallFrame());
+    frame->m_arena = AlignedBuffer(m_arena_size, get_alignment());
+    vector<shared_ptr<HostTensor>> slot_tensors(m_slots.size());
+    for (size_t i = 0; i < m_slots.size(); ++i)
+    {
+        const Slot& slot = m_slots[i];
+        switch (slot.m_kind)
+        {
+        case SlotKind::Arena:
+            slot_tensors[i] = make_shared<HostTensor>(
+                slot.m_element_type, slot.m_shape, frame->m_arena.get_ptr(slot.m_offset));
+            break;
+        case SlotKind::Constant:
+            slot_tensors[i] = make_shared<HostTensor>(
+                slot.m_element_type, slot.m_shape, const_cast<void*>(slot.m_constant_data));
+            break;
+        case SlotKind::Parameter:
+        case SlotKind::Result: break;
+        }
+    }
+    for (const PlannedOp& planned : m_planned_ops)
+    {
+        vector<shared_ptr<HostTensor>> op_inputs;
+        for (size_t slot : planned.m_input_slots)
+        {
+            op_inputs.push_back(slot_tensors[slot]);
+        }
+        vector<shared_ptr<HostTensor>> op_outputs;
+        for (size_t slot : planned.m_output_slots)
+        {
+            op_outputs.push_back(slot_tensors[slot]);
+        }
+        frame->m_op_inputs.push_back(move(op_inputs));
+        frame->m_op_outputs.push_back(move(op_outputs));
+    }
+    return frame;
+}
+
+void runtime::interpreter::INTExecutable::release_call_frame(unique_ptr<CallFrame> frame)
+{
+    lock_guard<mutex> lock(m_frame_mutex);
+    m_free_frames.push_back(move(frame));
+}
+
+vector<pair<const void*, size_t>> runtime::interpreter::INTExecutable::get_idle_arenas()
+{
+    lock_guard<mutex> lock(m_frame_mutex);
+    vector<pair<const void*, size_t>> arenas;
+    for (const unique_ptr<CallFrame>& frame : m_free_frames)
+    {
+        arenas.push_back({frame->m_arena.get_ptr(), frame->m_arena.size()});
+    }
+    return arenas;
 }
 
 bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
@@ -133,6 +314,75 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         func_outputs.push_back(host_tensor);
     }
 
+    if (!m_performance_counters_enabled)
+    {
+        return m_is_planned ? call_planned(func_outputs, func_inputs)
+                            : call_unplanned(func_outputs, func_inputs);
+    }
+    auto start = chrono::high_resolution_clock::now();
+    bool rc = m_is_planned ? call_planned(func_outputs, func_inputs)
+                           : call_unplanned(func_outputs, func_inputs);
+    m_call_performance.add_call(chrono::high_resolution_clock::now() - start);
+    return rc;
+}
+
+bool runtime::interpreter::INTExecutable::call_planned(
+    const vector<shared_ptr<HostTensor>>& outputs, const vector<shared_ptr<HostTensor>>& inputs)
+{
+    unique_ptr<CallFrame> frame = acquire_call_frame();
+
+    // bind function params and outputs into the prebuilt argument vectors
+    auto bind = [&](const vector<shared_ptr<HostTensor>>& tensors,
+                    const vector<SlotUses>& uses,
+                    vector<vector<shared_ptr<HostTensor>>>& args) {
+        for (size_t i = 0; i < uses.size(); ++i)
+        {
+            for (const pair<size_t, size_t>& use : uses[i])
+            {
+                args[use.first][use.second] = tensors[i];
+            }
+        }
+    };
+    // drop the references so the frame does not keep caller tensors alive
+    auto unbind = [&](const vector<SlotUses>& uses, vector<vector<shared_ptr<HostTensor>>>& args) {
+        for (const SlotUses& slot_uses : uses)
+        {
+            for (const pair<size_t, size_t>& use : slot_uses)
+            {
+                args[use.first][use.second] = nullptr;
+            }
+        }
+    };
+    bind(inputs, m_parameter_uses, frame->m_op_inputs);
+    bind(outputs, m_result_uses, frame->m_op_outputs);
+
+    try
+    {
+        for (size_t i = 0; i < m_planned_ops.size(); ++i)
+        {
+            const PlannedOp& planned = m_planned_ops[i];
+            execute_op(
+                planned.m_node, planned.m_type, frame->m_op_outputs[i], frame->m_op_inputs[i]);
+        }
+    }
+    catch (...)
+    {
+        unbind(m_parameter_uses, frame->m_op_inputs);
+        unbind(m_result_uses, frame->m_op_outputs);
+        release_call_frame(move(frame));
+        throw;
+    }
+    unbind(m_parameter_uses, frame->m_op_inputs);
+    unbind(m_result_uses, frame->m_op_outputs);
+    release_call_frame(move(frame));
+
+    return true;
+}
+
+bool runtime::interpreter::INTExecutable::call_unplanned(
+    const vector<shared_ptr<HostTensor>>& func_outputs,
+    const vector<shared_ptr<HostTensor>>& func_inputs)
+{
     // map function params -> HostTensor
     unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
     size_t input_count = 0;
@@ -160,7 +410,6 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
     // for each ordered op in the graph
     for (auto op : m_nodes)
     {
-        event::Duration d2(op->description(), "Interpreter");
         if (op->is_parameter())
         {
             continue;
@@ -193,51 +442,74 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             op_outputs.push_back(host_tensor);
         }
 
-        // get op type
-        element::Type type;
-        if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op) ||
-            is_type<op::ArgMin>(op) || is_type<op::ArgMax>(op))
-        {
-            type = op->get_input_element_type(0);
-        }
-        else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
-                 is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
-        {
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
-        }
-        else if (is_type<op::TopK>(op))
-        {
-            type = op->get_output_element_type(1);
-        }
-        else
-        {
-            type = op->get_output_element_type(0);
-        }
-
-        if (m_performance_counters_enabled)
-        {
-            m_timer_map[op].start();
-        }
-        if (!op->evaluate(op_outputs, op_inputs))
-        {
-            generate_calls(type, *op.get(), op_outputs, op_inputs);
-        }
-        if (m_performance_counters_enabled)
-        {
-            m_timer_map[op].stop();
-        }
-        if (m_nan_check_enabled)
-        {
-            perform_nan_check(op_outputs, op.get());
-        }
+        execute_op(op, get_dispatch_type(*op), op_outputs, op_inputs);
     }
 
     return true;
 }
 
+void runtime::interpreter::INTExecutable::execute_op(const shared_ptr<Node>& op,
+                                                     const element::Type& type,
+                                                     const vector<shared_ptr<HostTensor>>& outputs,
+                                                     const vector<shared_ptr<HostTensor>>& inputs)
+{
+    event::Duration d2(op->description(), "Interpreter");
+    chrono::high_resolution_clock::time_point start;
+    if (m_performance_counters_enabled)
+    {
+        start = chrono::high_resolution_clock::now();
+    }
+    if (!op->evaluate(outputs, inputs))
+    {
+        generate_calls(type, *op, outputs, inputs);
+    }
+    if (m_performance_counters_enabled)
+    {
+        record_op_time(op, chrono::high_resolution_clock::now() - start);
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(outputs, op.get());
+    }
+}
+
+element::Type runtime::interpreter::INTExecutable::get_dispatch_type(const Node& op)
+{
+    element::Type type;
+    if (is_type<op::Convert>(&op) || is_type<op::Quantize>(&op) || is_type<op::Dequantize>(&op) ||
+        is_type<op::ArgMin>(&op) || is_type<op::ArgMax>(&op) ||
+        is_type<op::v1::NonMaxSuppression>(&op) || is_type<op::v3::NonMaxSuppression>(&op))
+    {
+        type = op.get_input_element_type(0);
+    }
+    else if (is_type<op::Equal>(&op) || is_type<op::Greater>(&op) || is_type<op::GreaterEq>(&op) ||
+             is_type<op::Less>(&op) || is_type<op::LessEq>(&op) || is_type<op::NotEqual>(&op))
+    {
+        // Get the type of the second input, not the first
+        // All BinaryElementwiseComparision ops have the same type for inputs
+        // Select has bool for first input and the type we are interested in for the second
+        type = op.get_input_element_type(1);
+    }
+    else if (is_type<op::TopK>(&op))
+    {
+        type = op.get_output_element_type(1);
+    }
+    else
+    {
+        type = op.get_output_element_type(0);
+    }
+    return type;
+}
+
+future<bool> runtime::interpreter::INTExecutable::async_call(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    function<void(bool)> callback)
+{
+    bool serialize = m_performance_counters_enabled || m_has_stateful_ops;
+    return submit_async_call(outputs, inputs, move(callback), serialize);
+}
+
 void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
                                                          const Node& op,
                                                          const vector<shared_ptr<HostTensor>>& out,
@@ -276,13 +548,29 @@ vector<runtime::PerformanceCounter>
     runtime::interpreter::INTExecutable::get_performance_data() const
 {
     vector<runtime::PerformanceCounter> rc;
-    for (const pair<shared_ptr<const Node>, stopwatch> p : m_timer_map)
+    for (const auto& p : m_performance_map)
     {
-        rc.emplace_back(p.first, p.second.get_total_microseconds(), p.second.get_call_count());
+        rc.push_back(p.second);
     }
     return rc;
 }
 
+runtime::PerformanceCounter runtime::interpreter::INTExecutable::get_call_performance_data() const
+{
+    return m_call_performance;
+}
+
+void runtime::interpreter::INTExecutable::record_op_time(const shared_ptr<const Node>& op,
+                                                         chrono::nanoseconds duration)
+{
+    auto it = m_performance_map.find(op);
+    if (it == m_performance_map.end())
+    {
+        it = m_performance_map.insert({op, PerformanceCounter(op, 0, 0)}).first;
+    }
+    it->second.add_call(duration);
+}
+
 void runtime::interpreter::INTExecutable::perform_nan_check(
     const vector<shared_ptr<HostTensor>>& tensors, const Node* op)
 {
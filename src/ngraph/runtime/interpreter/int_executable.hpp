@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -55,20 +56,26 @@
 #include "ngraph/runtime/reference/cosh.hpp"
 #include "ngraph/runtime/reference/cum_sum.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
+#include "ngraph/runtime/reference/detection_output.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
+#include "ngraph/runtime/reference/embedding_segments_sum.hpp"
+#include "ngraph/runtime/reference/embeddingbag_offsets_sum.hpp"
 #include "ngraph/runtime/reference/erf.hpp"
 #include "ngraph/runtime/reference/exp.hpp"
 #include "ngraph/runtime/reference/floor.hpp"
 #include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
 #include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/reference/interpolate.hpp"
+#include "ngraph/runtime/reference/layer_norm.hpp"
 #include "ngraph/runtime/reference/log.hpp"
 #include "ngraph/runtime/reference/lrn.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/max_pool.hpp"
 #include "ngraph/runtime/reference/min.hpp"
 #include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
 #include "ngraph/runtime/reference/not.hpp"
 #include "ngraph/runtime/reference/one_hot.hpp"
 #include "ngraph/runtime/reference/pad.hpp"
@@ -82,6 +89,7 @@
 #include "ngraph/runtime/reference/result.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
+#include "ngraph/runtime/reference/roi_align.hpp"
 #include "ngraph/runtime/reference/round.hpp"
 #include "ngraph/runtime/reference/scatter_add.hpp"
 #include "ngraph/runtime/reference/scatter_nd_add.hpp"
@@ -138,12 +146,24 @@ public:
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& inputs) override;
 
+    /// \brief Runs calls concurrently unless performance counters or stateful ops (random
+    ///        number generators) make call() non-reentrant.
+    std::future<bool> async_call(const std::vector<std::shared_ptr<Tensor>>& outputs,
+                                 const std::vector<std::shared_ptr<Tensor>>& inputs,
+                                 std::function<void(bool)> callback = nullptr) override;
+
     virtual void save(std::ostream& output_stream) override;
 
     void set_nan_check(bool enable);
 
+    /// \brief Base address and size in bytes of the arena of each call frame kept for reuse
+    ///        by the planned schedule. Empty before the first call or for unplanned functions.
+    std::vector<std::pair<const void*, size_t>> get_idle_arenas();
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
+    PerformanceCounter get_call_performance_data() const override;
+
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
     std::shared_ptr<runtime::Tensor> create_output_tensor(size_t output_index) override;
@@ -160,16 +180,86 @@ protected:
     std::shared_ptr<ngraph::op::Parameter> get_parameter(size_t index) const;
     std::shared_ptr<ngraph::op::Result> get_result(size_t index) const;
     int get_alignment() const { return 64; }
+    /// \brief Adds one evaluation of op to its performance counter
+    void record_op_time(const std::shared_ptr<const Node>& op, std::chrono::nanoseconds duration);
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
     bool m_performance_counters_enabled = false;
+    bool m_has_stateful_ops = false;
     std::shared_ptr<Function> m_function;
-    std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
+    std::unordered_map<std::shared_ptr<const Node>, PerformanceCounter> m_performance_map;
+    PerformanceCounter m_call_performance{nullptr, 0, 0};
     std::vector<std::shared_ptr<Node>> m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
 
+    /// \brief An op of the planned schedule with its dispatch type and the slots of its
+    ///        input and output tensors resolved at compile time.
+    struct PlannedOp
+    {
+        std::shared_ptr<Node> m_node;
+        element::Type m_type;
+        std::vector<size_t> m_input_slots;
+        std::vector<size_t> m_output_slots;
+    };
+
+    /// \brief Where a function parameter or result is used in the planned schedule, as
+    ///        (planned op index, argument index) pairs.
+    using SlotUses = std::vector<std::pair<size_t, size_t>>;
+
+    /// \brief Per-call state of the planned schedule: the arena backing every intermediate
+    ///        tensor and the argument vectors of every planned op, bound once when the frame
+    ///        is created. Only parameter and result arguments are rebound on each call.
+    struct CallFrame
+    {
+        AlignedBuffer m_arena;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> m_op_inputs;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> m_op_outputs;
+    };
+
+    /// \brief Runs Liveness and MemoryLayout over m_function and builds the planned schedule.
+    ///        Functions with dynamic shapes or element types are left unplanned and run through
+    ///        call_unplanned.
+    void plan_memory();
+    bool call_planned(const std::vector<std::shared_ptr<HostTensor>>& outputs,
+                      const std::vector<std::shared_ptr<HostTensor>>& inputs);
+    bool call_unplanned(const std::vector<std::shared_ptr<HostTensor>>& outputs,
+                        const std::vector<std::shared_ptr<HostTensor>>& inputs);
+    std::unique_ptr<CallFrame> acquire_call_frame();
+    void release_call_frame(std::unique_ptr<CallFrame> frame);
+    void execute_op(const std::shared_ptr<Node>& op,
+                    const element::Type& type,
+                    const std::vector<std::shared_ptr<HostTensor>>& outputs,
+                    const std::vector<std::shared_ptr<HostTensor>>& inputs);
+
+    bool m_is_planned = false;
+    std::vector<PlannedOp> m_planned_ops;
+    // Slot table shared by all call frames. Intermediate slots hold an arena offset, constant
+    // slots hold the constant's data, parameter and result slots are bound per call.
+    enum class SlotKind
+    {
+        Arena,
+        Constant,
+        Parameter,
+        Result
+    };
+    struct Slot
+    {
+        SlotKind m_kind;
+        element::Type m_element_type;
+        Shape m_shape;
+        size_t m_offset;
+        const void* m_constant_data;
+    };
+    std::vector<Slot> m_slots;
+    std::vector<SlotUses> m_parameter_uses;
+    std::vector<SlotUses> m_result_uses;
+    size_t m_arena_size = 0;
+    std::mutex m_frame_mutex;
+    std::vector<std::unique_ptr<CallFrame>> m_free_frames;
+
     static OP_TYPEID get_typeid(const Node& node);
+    static element::Type get_dispatch_type(const Node& op);
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
@@ -678,6 +768,23 @@ protected:
 
             break;
         }
+        case OP_TYPEID::DetectionOutput:
+        {
+            const op::DetectionOutput* detection = static_cast<const op::DetectionOutput*>(&node);
+            if (node.get_input_size() != 3)
+            {
+                throw unsupported_op("DetectionOutput with auxiliary predictions");
+            }
+            reference::detection_output<T>(args[0]->get_data_ptr<const T>(),
+                                            args[1]->get_data_ptr<const T>(),
+                                            args[2]->get_data_ptr<const T>(),
+                                            out[0]->get_data_ptr<T>(),
+                                            detection->get_attrs(),
+                                            node.get_input_shape(0),
+                                            node.get_input_shape(2),
+                                            node.get_output_shape(0));
+            break;
+        }
         case OP_TYPEID::Dot:
         {
             const op::Dot* dot = static_cast<const op::Dot*>(&node);
@@ -736,6 +843,84 @@ protected:
             }
             break;
         }
+        case OP_TYPEID::EmbeddingBagOffsetsSum_v3:
+        {
+            const T* weights = args.size() > 4 ? args[4]->get_data_ptr<const T>() : nullptr;
+            size_t num_indices = shape_size(node.get_input_shape(1));
+            size_t num_bags = shape_size(node.get_input_shape(2));
+            if (node.get_input_element_type(1) == element::i64)
+            {
+                reference::embeddingbag_offsets_sum(
+                    args[0]->get_data_ptr<const T>(),
+                    node.get_input_shape(0),
+                    args[1]->get_data_ptr<const int64_t>(),
+                    num_indices,
+                    args[2]->get_data_ptr<const int64_t>(),
+                    num_bags,
+                    args.size() > 3 ? args[3]->get_data_ptr<const int64_t>() : nullptr,
+                    weights,
+                    out[0]->get_data_ptr<T>());
+            }
+            else if (node.get_input_element_type(1) == element::i32)
+            {
+                reference::embeddingbag_offsets_sum(
+                    args[0]->get_data_ptr<const T>(),
+                    node.get_input_shape(0),
+                    args[1]->get_data_ptr<const int32_t>(),
+                    num_indices,
+                    args[2]->get_data_ptr<const int32_t>(),
+                    num_bags,
+                    args.size() > 3 ? args[3]->get_data_ptr<const int32_t>() : nullptr,
+                    weights,
+                    out[0]->get_data_ptr<T>());
+            }
+            else
+            {
+                throw ngraph_error(std::string("Unsupported index type ") +
+                                   node.get_input_element_type(1).c_type_string() +
+                                   std::string(" in EmbeddingBagOffsetsSum"));
+            }
+            break;
+        }
+        case OP_TYPEID::EmbeddingSegmentsSum_v3:
+        {
+            const T* weights = args.size() > 5 ? args[5]->get_data_ptr<const T>() : nullptr;
+            size_t num_indices = shape_size(node.get_input_shape(1));
+            size_t num_segments = node.get_output_shape(0).at(0);
+            if (node.get_input_element_type(1) == element::i64)
+            {
+                reference::embedding_segments_sum(
+                    args[0]->get_data_ptr<const T>(),
+                    node.get_input_shape(0),
+                    args[1]->get_data_ptr<const int64_t>(),
+                    num_indices,
+                    args[2]->get_data_ptr<const int64_t>(),
+                    num_segments,
+                    args.size() > 4 ? args[4]->get_data_ptr<const int64_t>() : nullptr,
+                    weights,
+                    out[0]->get_data_ptr<T>());
+            }
+            else if (node.get_input_element_type(1) == element::i32)
+            {
+                reference::embedding_segments_sum(
+                    args[0]->get_data_ptr<const T>(),
+                    node.get_input_shape(0),
+                    args[1]->get_data_ptr<const int32_t>(),
+                    num_indices,
+                    args[2]->get_data_ptr<const int32_t>(),
+                    num_segments,
+                    args.size() > 4 ? args[4]->get_data_ptr<const int32_t>() : nullptr,
+                    weights,
+                    out[0]->get_data_ptr<T>());
+            }
+            else
+            {
+                throw ngraph_error(std::string("Unsupported index type ") +
+                                   node.get_input_element_type(1).c_type_string() +
+                                   std::string(" in EmbeddingSegmentsSum"));
+            }
+            break;
+        }
         case OP_TYPEID::Erf:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -808,6 +993,38 @@ protected:
             }
             break;
         }
+        case OP_TYPEID::Interpolate:
+        {
+            const op::Interpolate* interpolate = static_cast<const op::Interpolate*>(&node);
+            reference::interpolate<T>(args[0]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      node.get_input_shape(0),
+                                      node.get_output_shape(0),
+                                      interpolate->get_attrs());
+            break;
+        }
+        case OP_TYPEID::LayerNorm:
+        {
+            const op::LayerNorm* ln = static_cast<const op::LayerNorm*>(&node);
+            const Shape& shape = node.get_input_shape(0);
+            int64_t begin_norm_axis = ln->get_begin_norm_axis();
+            if (begin_norm_axis < 0)
+            {
+                begin_norm_axis += shape.size();
+            }
+            bool use_affine = ln->get_use_affine();
+            bool keep_stats = ln->get_keep_stats();
+            reference::layer_norm<T>(args[0]->get_data_ptr<const T>(),
+                                     use_affine ? args[1]->get_data_ptr<const T>() : nullptr,
+                                     use_affine ? args[2]->get_data_ptr<const T>() : nullptr,
+                                     out[0]->get_data_ptr<T>(),
+                                     keep_stats ? out[1]->get_data_ptr<T>() : nullptr,
+                                     keep_stats ? out[2]->get_data_ptr<T>() : nullptr,
+                                     shape,
+                                     static_cast<size_t>(begin_norm_axis),
+                                     ln->get_epsilon());
+            break;
+        }
         case OP_TYPEID::Log:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -885,6 +1102,57 @@ protected:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::NonMaxSuppression_v1:
+        case OP_TYPEID::NonMaxSuppression_v3:
+        {
+            reference::NMSParameters params;
+            bool sort_result_descending;
+            if (get_typeid(node) == OP_TYPEID::NonMaxSuppression_v1)
+            {
+                const op::v1::NonMaxSuppression* nms =
+                    static_cast<const op::v1::NonMaxSuppression*>(&node);
+                params.center_encoding = nms->get_box_encoding() ==
+                                         op::v1::NonMaxSuppression::BoxEncodingType::CENTER;
+                sort_result_descending = nms->get_sort_result_descending();
+            }
+            else
+            {
+                const op::v3::NonMaxSuppression* nms =
+                    static_cast<const op::v3::NonMaxSuppression*>(&node);
+                params.center_encoding = nms->get_box_encoding() ==
+                                         op::v3::NonMaxSuppression::BoxEncodingType::CENTER;
+                sort_result_descending = nms->get_sort_result_descending();
+            }
+            params.max_selected = read_index_vector(args[2]).at(0);
+            params.iou_threshold = read_float_vector(args[3]).at(0);
+            params.score_threshold = read_float_vector(args[4]).at(0);
+            size_t output_rows = node.get_output_shape(0).at(0);
+            if (node.get_output_element_type(0) == element::i64)
+            {
+                reference::non_max_suppression(args[0]->get_data_ptr<const T>(),
+                                               args[1]->get_data_ptr<const T>(),
+                                               node.get_input_shape(1),
+                                               params,
+                                               sort_result_descending,
+                                               out[0]->get_data_ptr<int64_t>(),
+                                               output_rows);
+            }
+            else if (node.get_output_element_type(0) == element::i32)
+            {
+                reference::non_max_suppression(args[0]->get_data_ptr<const T>(),
+                                               args[1]->get_data_ptr<const T>(),
+                                               node.get_input_shape(1),
+                                               params,
+                                               sort_result_descending,
+                                               out[0]->get_data_ptr<int32_t>(),
+                                               output_rows);
+            }
+            else
+            {
+                throw ngraph_error("Unexpected type");
+            }
+            break;
+        }
         case OP_TYPEID::LogicalNot_v1:
         case OP_TYPEID::Not:
         {
@@ -1280,6 +1548,42 @@ protected:
             }
             break;
         }
+        case OP_TYPEID::ROIAlign_v3:
+        {
+            const op::v3::ROIAlign* roi_align = static_cast<const op::v3::ROIAlign*>(&node);
+            bool max_mode = roi_align->get_mode() == op::v3::ROIAlign::PoolingMode::MAX;
+            if (node.get_input_element_type(2) == element::i64)
+            {
+                reference::roi_align(args[0]->get_data_ptr<const T>(),
+                                     args[1]->get_data_ptr<const T>(),
+                                     args[2]->get_data_ptr<const int64_t>(),
+                                     out[0]->get_data_ptr<T>(),
+                                     node.get_input_shape(0),
+                                     node.get_output_shape(0),
+                                     roi_align->get_sampling_ratio(),
+                                     roi_align->get_spatial_scale(),
+                                     max_mode);
+            }
+            else if (node.get_input_element_type(2) == element::i32)
+            {
+                reference::roi_align(args[0]->get_data_ptr<const T>(),
+                                     args[1]->get_data_ptr<const T>(),
+                                     args[2]->get_data_ptr<const int32_t>(),
+                                     out[0]->get_data_ptr<T>(),
+                                     node.get_input_shape(0),
+                                     node.get_output_shape(0),
+                                     roi_align->get_sampling_ratio(),
+                                     roi_align->get_spatial_scale(),
+                                     max_mode);
+            }
+            else
+            {
+                throw ngraph_error(std::string("Unsupported index type ") +
+                                   node.get_input_element_type(2).c_type_string() +
+                                   std::string(" in ROIAlign"));
+            }
+            break;
+        }
         case OP_TYPEID::Round:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -1512,8 +1816,6 @@ protected:
         case OP_TYPEID::GroupConvolutionBackpropFilters:
         case OP_TYPEID::GRUCell:
         case OP_TYPEID::HardSigmoid:
-        case OP_TYPEID::Interpolate:
-        case OP_TYPEID::LayerNorm:
         case OP_TYPEID::LayerNormBackprop:
         case OP_TYPEID::LSTMCell:
         case OP_TYPEID::LSTMSequence:
@@ -16,6 +16,7 @@
 
 #define ID_SUFFIX(NAME) NAME
 #include "ngraph/opsets/opset0_tbl.hpp"
+NGRAPH_OP(DetectionOutput, op::v0)
 #undef ID_SUFFIX
 
 #define ID_SUFFIX(NAME) NAME##_v1
@@ -24,9 +25,14 @@ NGRAPH_OP(LogicalAnd, op::v1)
 NGRAPH_OP(LogicalOr, op::v1)
 NGRAPH_OP(LogicalXor, op::v1)
 NGRAPH_OP(LogicalNot, op::v1)
+NGRAPH_OP(NonMaxSuppression, op::v1)
 #undef ID_SUFFIX
 
 #define ID_SUFFIX(NAME) NAME##_v3
+NGRAPH_OP(EmbeddingBagOffsetsSum, op::v3)
+NGRAPH_OP(EmbeddingSegmentsSum, op::v3)
 NGRAPH_OP(ShapeOf, op::v3)
 NGRAPH_OP(NonZero, op::v3)
+NGRAPH_OP(NonMaxSuppression, op::v3)
+NGRAPH_OP(ROIAlign, op::v3)
 #undef ID_SUFFIX
@@ -0,0 +1,266 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/fused/matmul.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Values below 16 have a bucket each. Above, each power of two is split into 16 buckets.
+static const size_t s_sub_buckets = 16;
+
+static size_t get_bucket_index(uint64_t value)
+{
+    if (value < s_sub_buckets)
+    {
+        return value;
+    }
+    size_t exponent = 0;
+    for (uint64_t x = value; x > 1; x >>= 1)
+    {
+        exponent++;
+    }
+    return s_sub_buckets * (exponent - 3) + ((value >> (exponent - 4)) & (s_sub_buckets - 1));
+}
+
+static double get_bucket_midpoint(size_t index)
+{
+    if (index < s_sub_buckets)
+    {
+        return index;
+    }
+    size_t shift = index / s_sub_buckets - 1;
+    uint64_t lower = (s_sub_buckets + index % s_sub_buckets) << shift;
+    uint64_t width = uint64_t(1) << shift;
+    return lower + (width - 1) / 2.0;
+}
+
+void runtime::LatencyHistogram::add(chrono::nanoseconds latency)
+{
+    size_t index = get_bucket_index(static_cast<uint64_t>(max<int64_t>(latency.count(), 0)));
+    if (index >= m_buckets.size())
+    {
+        m_buckets.resize(index + 1);
+    }
+    m_buckets[index]++;
+    m_count++;
+}
+
+void runtime::LatencyHistogram::add(const LatencyHistogram& other)
+{
+    if (other.m_buckets.size() > m_buckets.size())
+    {
+        m_buckets.resize(other.m_buckets.size());
+    }
+    for (size_t i = 0; i < other.m_buckets.size(); i++)
+    {
+        m_buckets[i] += other.m_buckets[i];
+    }
+    m_count += other.m_count;
+}
+
+double runtime::LatencyHistogram::get_percentile(double percentile) const
+{
+    if (m_count == 0)
+    {
+        return 0;
+    }
+    double clamped = min(max(percentile, 0.0), 100.0);
+    size_t rank = max<size_t>(static_cast<size_t>(ceil(clamped / 100 * m_count)), 1);
+    size_t seen = 0;
+    for (size_t i = 0; i < m_buckets.size(); i++)
+    {
+        seen += m_buckets[i];
+        if (seen >= rank)
+        {
+            return get_bucket_midpoint(i);
+        }
+    }
+    return get_bucket_midpoint(m_buckets.size() - 1);
+}
+
+static size_t get_tensor_bytes(const element::Type& type, const PartialShape& shape)
+{
+    return shape.is_static() ? shape_size(shape.to_shape()) * type.size() : 0;
+}
+
+runtime::PerformanceCounter::PerformanceCounter(const shared_ptr<const Node>& n,
+                                                size_t us,
+                                                size_t calls)
+    : m_node(n)
+    , m_total_microseconds(us)
+    , m_call_count(calls)
+    , m_total_nanoseconds(static_cast<uint64_t>(us) * 1000)
+{
+    if (m_node)
+    {
+        for (const descriptor::Input& input : m_node->get_inputs())
+        {
+            m_bytes_read +=
+                get_tensor_bytes(input.get_element_type(), input.get_output().get_partial_shape());
+        }
+        for (size_t i = 0; i < m_node->get_output_size(); i++)
+        {
+            m_bytes_written += get_tensor_bytes(m_node->get_output_element_type(i),
+                                                m_node->get_output_partial_shape(i));
+        }
+        m_flops = estimate_flops(*m_node);
+    }
+}
+
+void runtime::PerformanceCounter::add_call(chrono::nanoseconds duration)
+{
+    m_total_nanoseconds += static_cast<uint64_t>(max<int64_t>(duration.count(), 0));
+    m_total_microseconds = m_total_nanoseconds / 1000;
+    m_call_count++;
+    m_latency.add(duration);
+}
+
+void runtime::ConcurrentPerformanceCounter::add_call(chrono::nanoseconds duration)
+{
+    uint64_t nanoseconds = static_cast<uint64_t>(max<int64_t>(duration.count(), 0));
+    size_t index = min(get_bucket_index(nanoseconds), s_bucket_count - 1);
+    m_buckets[index].fetch_add(1, memory_order_relaxed);
+    m_total_nanoseconds.fetch_add(nanoseconds, memory_order_relaxed);
+    m_call_count.fetch_add(1, memory_order_relaxed);
+}
+
+runtime::PerformanceCounter
+    runtime::ConcurrentPerformanceCounter::get_counter(const shared_ptr<const Node>& n) const
+{
+    PerformanceCounter counter(n, 0, 0);
+    // Calls still being recorded may be missing from some of the totals
+    counter.m_latency.m_buckets.resize(s_bucket_count);
+    for (size_t i = 0; i < s_bucket_count; i++)
+    {
+        size_t count = m_buckets[i].load(memory_order_relaxed);
+        counter.m_latency.m_buckets[i] = count;
+        counter.m_latency.m_count += count;
+    }
+    counter.m_total_nanoseconds = m_total_nanoseconds.load(memory_order_relaxed);
+    counter.m_total_microseconds = counter.m_total_nanoseconds / 1000;
+    counter.m_call_count = m_call_count.load(memory_order_relaxed);
+    return counter;
+}
+
+double runtime::PerformanceCounter::percentile_microseconds(double percentile) const
+{
+    if (m_latency.get_count() == 0)
+    {
+        return m_call_count == 0 ? 0 : total_seconds() * 1e6 / m_call_count;
+    }
+    return m_latency.get_percentile(percentile) / 1000;
+}
+
+double runtime::PerformanceCounter::total_seconds() const
+{
+    // Backends that only count microseconds set m_total_microseconds directly
+    if (m_total_nanoseconds / 1000 != m_total_microseconds)
+    {
+        return m_total_microseconds * 1e-6;
+    }
+    return m_total_nanoseconds * 1e-9;
+}
+
+double runtime::PerformanceCounter::gflops_per_second() const
+{
+    double seconds = total_seconds();
+    return seconds == 0 ? 0 : m_flops * m_call_count / seconds * 1e-9;
+}
+
+double runtime::PerformanceCounter::gigabytes_per_second() const
+{
+    double seconds = total_seconds();
+    return seconds == 0 ? 0 : double(m_bytes_read + m_bytes_written) * m_call_count / seconds *
+                                  1e-9;
+}
+
+double runtime::PerformanceCounter::arithmetic_intensity() const
+{
+    size_t bytes = m_bytes_read + m_bytes_written;
+    return bytes == 0 ? 0 : m_flops / bytes;
+}
+
+double runtime::PerformanceCounter::estimate_flops(const Node& node)
+{
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        if (node.get_input_partial_shape(i).is_dynamic())
+        {
+            return 0;
+        }
+    }
+    for (size_t i = 0; i < node.get_output_size(); i++)
+    {
+        if (node.get_output_partial_shape(i).is_dynamic())
+        {
+            return 0;
+        }
+    }
+
+    double flops = 0;
+    if (auto dot = as_type<const op::v0::Dot>(&node))
+    {
+        // Each output element sums the products over the reduction axes of the first input
+        const Shape& arg0_shape = dot->get_input_shape(0);
+        double reduction_size = 1;
+        size_t axes = min(dot->get_reduction_axes_count(), arg0_shape.size());
+        for (size_t i = arg0_shape.size() - axes; i < arg0_shape.size(); i++)
+        {
+            reduction_size *= arg0_shape[i];
+        }
+        flops = 2 * reduction_size * shape_size(dot->get_output_shape(0));
+    }
+    else if (auto matmul = as_type<const op::v0::MatMul>(&node))
+    {
+        const Shape& arg0_shape = matmul->get_input_shape(0);
+        double reduction_size = 1;
+        if (!arg0_shape.empty())
+        {
+            reduction_size = (matmul->get_transpose_a() && arg0_shape.size() > 1)
+                                 ? arg0_shape[arg0_shape.size() - 2]
+                                 : arg0_shape.back();
+        }
+        flops = 2 * reduction_size * shape_size(matmul->get_output_shape(0));
+    }
+    else if (is_type<op::v0::Convolution>(&node) || is_type<op::v1::Convolution>(&node))
+    {
+        // Each output element is a dot product with one filter, of C_in * spatial elements
+        const Shape& filters_shape = node.get_input_shape(1);
+        double filter_size =
+            filters_shape.empty() ? 0 : double(shape_size(filters_shape)) / filters_shape[0];
+        flops = 2 * filter_size * shape_size(node.get_output_shape(0));
+    }
+    else if (dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(&node) ||
+             dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(&node))
+    {
+        flops = shape_size(node.get_output_shape(0));
+    }
+    else if (dynamic_cast<const op::util::ArithmeticReduction*>(&node))
+    {
+        flops = shape_size(node.get_input_shape(0));
+    }
+    return flops;
+}
@@ -16,8 +16,13 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "ngraph/node.hpp"
 
@@ -25,15 +30,34 @@ namespace ngraph
 {
     namespace runtime
     {
+        /// \brief Distribution of latencies in buckets whose width is 1/16 of a power of two,
+        ///        so percentiles are estimated within about 3% with constant memory.
+        class NGRAPH_API LatencyHistogram
+        {
+        public:
+            void add(std::chrono::nanoseconds latency);
+            /// \brief Adds all the latencies recorded by another histogram
+            void add(const LatencyHistogram& other);
+            size_t get_count() const { return m_count; }
+            /// \brief Estimates a percentile of the recorded latencies
+            /// \param percentile Percentile in [0, 100]
+            /// \returns The latency in nanoseconds, 0 if nothing was recorded
+            double get_percentile(double percentile) const;
+
+        private:
+            friend class ConcurrentPerformanceCounter;
+
+            std::vector<size_t> m_buckets;
+            size_t m_count{0};
+        };
+
         class NGRAPH_API PerformanceCounter
         {
         public:
-            PerformanceCounter(const std::shared_ptr<const Node>& n, size_t us, size_t calls)
-                : m_node(n)
-                , m_total_microseconds(us)
-                , m_call_count(calls)
-            {
-            }
+            /// \param n The node, or nullptr for a counter of whole calls
+            /// \param us Total time of the calls so far in microseconds
+            /// \param calls Number of calls so far
+            PerformanceCounter(const std::shared_ptr<const Node>& n, size_t us, size_t calls);
             std::shared_ptr<const Node> get_node() const { return m_node; }
             size_t total_microseconds() const { return m_total_microseconds; }
             size_t microseconds() const
@@ -41,9 +65,70 @@ namespace ngraph
                 return m_call_count == 0 ? 0 : m_total_microseconds / m_call_count;
             }
             size_t call_count() const { return m_call_count; }
+            /// \brief Records one call, adding it to the totals and the latency histogram
+            void add_call(std::chrono::nanoseconds duration);
+
+            const LatencyHistogram& get_latency_histogram() const { return m_latency; }
+            /// \brief Latency percentile of a call, the mean when no histogram was recorded
+            /// \param percentile Percentile in [0, 100]
+            double percentile_microseconds(double percentile) const;
+            double p50_microseconds() const { return percentile_microseconds(50); }
+            double p99_microseconds() const { return percentile_microseconds(99); }
+            /// \brief Bytes of the inputs of the node, read once per call
+            size_t bytes_read() const { return m_bytes_read; }
+            /// \brief Bytes of the outputs of the node, written once per call
+            size_t bytes_written() const { return m_bytes_written; }
+            /// \brief Estimated floating point operations per call, 0 for ops not modelled
+            double flops() const { return m_flops; }
+            /// \brief Achieved rate over all calls, 0 before any time was recorded
+            double gflops_per_second() const;
+            /// \brief Achieved bandwidth over all calls, 0 before any time was recorded
+            double gigabytes_per_second() const;
+            /// \brief Estimated floating point operations per byte moved
+            double arithmetic_intensity() const;
+
+            /// \brief Estimates the floating point operations of one evaluation of a node
+            ///        from its static shapes: multiply-adds for Dot, MatMul and Convolution,
+            ///        one per output element for elementwise arithmetic and one per input
+            ///        element for arithmetic reductions.
+            static double estimate_flops(const Node& node);
+
             std::shared_ptr<const Node> m_node;
             size_t m_total_microseconds;
             size_t m_call_count;
+
+        private:
+            friend class ConcurrentPerformanceCounter;
+
+            double total_seconds() const;
+
+            uint64_t m_total_nanoseconds;
+            LatencyHistogram m_latency;
+            size_t m_bytes_read{0};
+            size_t m_bytes_written{0};
+            double m_flops{0};
+        };
+
+        /// \brief Records calls into fixed atomic buckets, so calls running concurrently on
+        ///        several threads can be counted without a lock.
+        ///
+        /// Latencies above about 36 minutes all land in the last bucket.
+        class NGRAPH_API ConcurrentPerformanceCounter
+        {
+        public:
+            void add_call(std::chrono::nanoseconds duration);
+            /// \brief Counts a call that was skipped and not timed
+            void add_untimed_call() { m_call_count.fetch_add(1, std::memory_order_relaxed); }
+            /// \brief Snapshot of the calls recorded so far
+            /// \param n The node, or nullptr for a counter of whole calls
+            PerformanceCounter get_counter(const std::shared_ptr<const Node>& n) const;
+
+        private:
+            static const size_t s_bucket_count = 16 * 38;
+
+            std::array<std::atomic<uint64_t>, s_bucket_count> m_buckets{};
+            std::atomic<uint64_t> m_total_nanoseconds{0};
+            std::atomic<size_t> m_call_count{0};
         };
     }
 }
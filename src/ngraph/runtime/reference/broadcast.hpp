@@ -18,8 +18,11 @@
 
 #include <cmath>
 
+#include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/copy.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_offset_iterator.hpp"
 
 namespace ngraph
 {
@@ -53,15 +56,25 @@ namespace ngraph
                         adjusted_axes.insert(axis);
                     }
                 }
-                CoordinateTransform input_transform(adjusted_in_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
+                // Output axes that are not broadcast walk the remaining input axes in order;
+                // broadcast axes do not move through the input at all.
+                std::vector<std::ptrdiff_t> in_strides =
+                    StridedOffsetIterator::row_major_strides(adjusted_in_shape);
+                std::vector<std::ptrdiff_t> out_walk_strides(out_shape.size(), 0);
+                size_t in_axis = 0;
+                for (size_t axis = 0; axis < out_shape.size(); axis++)
                 {
-                    Coordinate input_coord = reduce(output_coord, adjusted_axes);
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
+                    if (adjusted_axes.count(axis) == 0)
+                    {
+                        NGRAPH_CHECK(in_axis < in_strides.size(),
+                                     "Broadcast input has fewer axes than expected");
+                        out_walk_strides[axis] = in_strides[in_axis++];
+                    }
                 }
+                NGRAPH_CHECK(in_axis == in_strides.size(),
+                             "Broadcast input has more axes than expected");
+
+                strided_copy(arg, out, StridedOffsetIterator(out_shape, out_walk_strides));
             }
         }
     }
@@ -16,13 +16,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <functional>
+#include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -49,6 +52,167 @@ namespace ngraph
                 using type = long double;
             };
 
+            // Direct convolution for the forward layout (in: N,C,spatial...,
+            // filter: OC,C,spatial...)
+            // with up to three spatial axes and no input dilation. Input and filter are first
+            // repacked with channels innermost so the channel reduction walks contiguous memory,
+            // then output rows are computed in parallel. Products are summed in the same order
+            // as the generic loop below, so results are identical.
+            template <typename INPUT, typename FILTER, typename OUTPUT, typename ACCUMULATION>
+            void direct_convolution(const INPUT* in,
+                                    const FILTER* filter,
+                                    OUTPUT* out,
+                                    const Shape& in_shape,
+                                    const Shape& filter_shape,
+                                    const Shape& out_shape,
+                                    const Strides& stride,
+                                    const Strides& filter_dilation,
+                                    const CoordinateDiff& in_pad_below,
+                                    const float* input_scale,
+                                    const INPUT* input_zero_point,
+                                    const float* filter_scale,
+                                    const FILTER* filter_zero_point,
+                                    const float* output_scale,
+                                    const OUTPUT* output_zero_point)
+            {
+                bool is_quantized = input_scale && input_zero_point && filter_scale &&
+                                    filter_zero_point && output_scale && output_zero_point;
+
+                // Lift 1D and 2D convolutions to 3D by prepending unit spatial axes
+                size_t lift = 5 - in_shape.size();
+                Shape in_3d(lift, 1);
+                Shape filter_3d(lift, 1);
+                Shape out_3d(lift, 1);
+                Strides stride_3d(lift, 1);
+                Strides dilation_3d(lift, 1);
+                CoordinateDiff pad_3d(lift, 0);
+                in_3d.insert(in_3d.end(), in_shape.begin() + 2, in_shape.end());
+                filter_3d.insert(filter_3d.end(), filter_shape.begin() + 2, filter_shape.end());
+                out_3d.insert(out_3d.end(), out_shape.begin() + 2, out_shape.end());
+                stride_3d.insert(stride_3d.end(), stride.begin(), stride.end());
+                dilation_3d.insert(
+                    dilation_3d.end(), filter_dilation.begin(), filter_dilation.end());
+                pad_3d.insert(pad_3d.end(), in_pad_below.begin(), in_pad_below.end());
+
+                size_t batch = in_shape[0];
+                size_t channels = in_shape[1];
+                size_t out_channels = filter_shape[0];
+                size_t in_spatial = shape_size(in_3d);
+                size_t filter_spatial = shape_size(filter_3d);
+
+                ACCUMULATION in_offset = 0;
+                ACCUMULATION filter_offset = 0;
+                float scale = 1;
+                if (is_quantized)
+                {
+                    in_offset = static_cast<ACCUMULATION>(*input_zero_point);
+                    filter_offset = static_cast<ACCUMULATION>(*filter_zero_point);
+                    scale = *input_scale * *filter_scale / *output_scale;
+                }
+
+                std::vector<ACCUMULATION> in_packed(batch * in_spatial * channels);
+                for (size_t b = 0; b < batch; b++)
+                {
+                    for (size_t c = 0; c < channels; c++)
+                    {
+                        const INPUT* src = in + (b * channels + c) * in_spatial;
+                        ACCUMULATION* dst = &in_packed[b * in_spatial * channels + c];
+                        for (size_t i = 0; i < in_spatial; i++)
+                        {
+                            dst[i * channels] = static_cast<ACCUMULATION>(src[i]) - in_offset;
+                        }
+                    }
+                }
+                std::vector<ACCUMULATION> filter_packed(out_channels * filter_spatial * channels);
+                for (size_t oc = 0; oc < out_channels; oc++)
+                {
+                    for (size_t c = 0; c < channels; c++)
+                    {
+                        const FILTER* src = filter + (oc * channels + c) * filter_spatial;
+                        ACCUMULATION* dst = &filter_packed[oc * filter_spatial * channels + c];
+                        for (size_t i = 0; i < filter_spatial; i++)
+                        {
+                            dst[i * channels] = static_cast<ACCUMULATION>(src[i]) - filter_offset;
+                        }
+                    }
+                }
+
+                // One unit of parallel work is a row of output along the innermost axis
+                size_t rows = batch * out_channels * out_3d[0] * out_3d[1];
+                size_t row_work = out_3d[2] * filter_spatial * channels;
+                size_t grain =
+                    std::max<size_t>(1, (size_t(1) << 16) / std::max<size_t>(row_work, 1));
+                parallel_for(rows, grain, [&](size_t begin, size_t end) {
+                    for (size_t row = begin; row < end; row++)
+                    {
+                        size_t oh = row % out_3d[1];
+                        size_t od = (row / out_3d[1]) % out_3d[0];
+                        size_t oc = (row / (out_3d[1] * out_3d[0])) % out_channels;
+                        size_t b = row / (out_3d[1] * out_3d[0] * out_channels);
+                        const ACCUMULATION* in_batch = &in_packed[b * in_spatial * channels];
+                        const ACCUMULATION* filter_oc =
+                            &filter_packed[oc * filter_spatial * channels];
+                        OUTPUT* out_row = out + row * out_3d[2];
+
+                        for (size_t ow = 0; ow < out_3d[2]; ow++)
+                        {
+                            ACCUMULATION result = 0;
+                            for (size_t kd = 0; kd < filter_3d[0]; kd++)
+                            {
+                                std::ptrdiff_t id = std::ptrdiff_t(od * stride_3d[0]) +
+                                                    std::ptrdiff_t(kd * dilation_3d[0]) -
+                                                    pad_3d[0];
+                                if (id < 0 || id >= std::ptrdiff_t(in_3d[0]))
+                                {
+                                    continue;
+                                }
+                                for (size_t kh = 0; kh < filter_3d[1]; kh++)
+                                {
+                                    std::ptrdiff_t ih = std::ptrdiff_t(oh * stride_3d[1]) +
+                                                        std::ptrdiff_t(kh * dilation_3d[1]) -
+                                                        pad_3d[1];
+                                    if (ih < 0 || ih >= std::ptrdiff_t(in_3d[1]))
+                                    {
+                                        continue;
+                                    }
+                                    for (size_t kw = 0; kw < filter_3d[2]; kw++)
+                                    {
+                                        std::ptrdiff_t iw = std::ptrdiff_t(ow * stride_3d[2]) +
+                                                            std::ptrdiff_t(kw * dilation_3d[2]) -
+                                                            pad_3d[2];
+                                        if (iw < 0 || iw >= std::ptrdiff_t(in_3d[2]))
+                                        {
+                                            continue;
+                                        }
+                                        const ACCUMULATION* in_v =
+                                            in_batch +
+                                            ((id * in_3d[1] + ih) * in_3d[2] + iw) * channels;
+                                        const ACCUMULATION* f_v =
+                                            filter_oc +
+                                            ((kd * filter_3d[1] + kh) * filter_3d[2] + kw) *
+                                                channels;
+                                        for (size_t c = 0; c < channels; c++)
+                                        {
+                                            result += in_v[c] * f_v[c];
+                                        }
+                                    }
+                                }
+                            }
+                            if (is_quantized)
+                            {
+                                out_row[ow] = static_cast<OUTPUT>(std::round(
+                                                  static_cast<float>(result) * scale)) +
+                                              *output_zero_point;
+                            }
+                            else
+                            {
+                                out_row[ow] = result;
+                            }
+                        }
+                    }
+                });
+            }
+
             // in: NC_I...
             // filter: C_OC_I...
             // out: NC_O...
@@ -89,6 +253,35 @@ namespace ngraph
 
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
+
+                bool is_forward_layout = in_batch_axis == 0 && in_channel_axis == 1 &&
+                                         filter_out_channel_axis == 0 &&
+                                         filter_in_channel_axis == 1 && out_batch_axis == 0 &&
+                                         out_channel_axis == 1;
+                bool is_unit_in_dilation = std::all_of(
+                    in_dilation.begin(), in_dilation.end(), [](size_t d) { return d == 1; });
+                if (is_forward_layout && is_unit_in_dilation && in_shape.size() >= 3 &&
+                    in_shape.size() <= 5)
+                {
+                    direct_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(in,
+                                                                            filter,
+                                                                            out,
+                                                                            in_shape,
+                                                                            filter_shape,
+                                                                            out_shape,
+                                                                            stride,
+                                                                            filter_dilation,
+                                                                            in_pad_below,
+                                                                            input_scale,
+                                                                            input_zero_point,
+                                                                            filter_scale,
+                                                                            filter_zero_point,
+                                                                            output_scale,
+                                                                            output_zero_point);
+                    std::fesetround(old_mode);
+                    return;
+                }
+
                 // Comments throughout assume without loss of generality that:
                 //
                 // * batch axes for both in and out are 0
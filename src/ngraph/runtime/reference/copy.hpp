@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
+#include "ngraph/strided_offset_iterator.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -32,6 +35,32 @@ namespace ngraph
                     out[i] = arg[i];
                 }
             }
+
+            /// \brief Copies arg[it.source_offset()] to out[it.target_offset()] for every
+            ///        element visited by it.
+            template <typename T>
+            void strided_copy(const T* arg, T* out, StridedOffsetIterator it)
+            {
+                for (; !it.done(); it.next_run())
+                {
+                    const T* src = arg + it.source_offset();
+                    T* dst = out + it.target_offset();
+                    size_t count = it.run_size();
+                    std::ptrdiff_t src_stride = it.source_run_stride();
+                    std::ptrdiff_t dst_stride = it.target_run_stride();
+                    if (src_stride == 1 && dst_stride == 1)
+                    {
+                        std::copy(src, src + count, dst);
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            dst[i * dst_stride] = src[i * src_stride];
+                        }
+                    }
+                }
+            }
         }
     }
 }
@@ -0,0 +1,271 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/op/detection_output.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace detection
+            {
+                // Prior box [xmin, ymin, xmax, ymax] plus a location prediction for it, decoded
+                // into a box [xmin, ymin, xmax, ymax]
+                inline void decode_box(const float* prior,
+                                       const float* variance,
+                                       const float* loc,
+                                       bool center_size,
+                                       bool clip,
+                                       float* box)
+                {
+                    if (center_size)
+                    {
+                        float prior_w = prior[2] - prior[0];
+                        float prior_h = prior[3] - prior[1];
+                        float prior_cx = (prior[0] + prior[2]) / 2;
+                        float prior_cy = (prior[1] + prior[3]) / 2;
+                        float cx = variance[0] * loc[0] * prior_w + prior_cx;
+                        float cy = variance[1] * loc[1] * prior_h + prior_cy;
+                        float w = std::exp(variance[2] * loc[2]) * prior_w;
+                        float h = std::exp(variance[3] * loc[3]) * prior_h;
+                        box[0] = cx - w / 2;
+                        box[1] = cy - h / 2;
+                        box[2] = cx + w / 2;
+                        box[3] = cy + h / 2;
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < 4; i++)
+                        {
+                            box[i] = prior[i] + variance[i] * loc[i];
+                        }
+                    }
+                    if (clip)
+                    {
+                        for (size_t i = 0; i < 4; i++)
+                        {
+                            box[i] = std::max(0.0f, std::min(1.0f, box[i]));
+                        }
+                    }
+                }
+            }
+
+            /// \brief DetectionOutput with Caffe SSD semantics for the three input form.
+            ///
+            /// Location predictions are decoded against the priors, each class of each image
+            /// goes through non-max suppression in parallel, and the keep_top_k highest scoring
+            /// detections of every image are written as [image, label, score, xmin, ymin, xmax,
+            /// ymax], by ascending label and then descending score. Rows past the last detection
+            /// have image -1.
+            ///
+            /// \param location [images, priors * location classes * 4]
+            /// \param confidence [images, priors * classes]
+            /// \param priors [1 or images, 1 or 2, priors * prior size], with the variances in
+            ///        the second row unless they are encoded in the location predictions
+            /// \param parallel Runs the parallel loops, runtime::parallel_for by default
+            template <typename T>
+            void detection_output(const T* location,
+                                  const T* confidence,
+                                  const T* priors,
+                                  T* output,
+                                  const op::DetectionOutputAttrs& attrs,
+                                  const Shape& location_shape,
+                                  const Shape& priors_shape,
+                                  const Shape& output_shape,
+                                  const ParallelFor& parallel = parallel_for)
+            {
+                NGRAPH_CHECK(!attrs.decrease_label_id,
+                             "DetectionOutput with decrease_label_id is not supported");
+                bool center_size;
+                if (attrs.code_type == "caffe.PriorBoxParameter.CENTER_SIZE")
+                {
+                    center_size = true;
+                }
+                else
+                {
+                    NGRAPH_CHECK(attrs.code_type == "caffe.PriorBoxParameter.CORNER",
+                                 "Unsupported DetectionOutput code type ",
+                                 attrs.code_type);
+                    center_size = false;
+                }
+
+                size_t images = location_shape[0];
+                size_t classes = static_cast<size_t>(attrs.num_classes);
+                size_t loc_classes = attrs.share_location ? 1 : classes;
+                size_t prior_size = attrs.normalized ? 4 : 5;
+                size_t prior_offset = attrs.normalized ? 0 : 1;
+                size_t num_priors = priors_shape[2] / prior_size;
+                size_t prior_rows = priors_shape[1];
+                NGRAPH_CHECK(attrs.variance_encoded_in_target || prior_rows == 2,
+                             "DetectionOutput priors need a row of variances");
+                size_t out_rows = output_shape[2];
+
+                // Decoded boxes, [images, loc_classes, priors, 4]
+                std::vector<float> boxes(images * loc_classes * num_priors * 4);
+                parallel(images * num_priors, 64, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        size_t image = i / num_priors;
+                        size_t p = i % num_priors;
+                        const T* image_priors = priors + (priors_shape[0] == 1 ? 0 : image) *
+                                                             prior_rows * num_priors * prior_size;
+                        const T* prior_data = image_priors + p * prior_size + prior_offset;
+                        float prior[4];
+                        float variance[4] = {1, 1, 1, 1};
+                        for (size_t k = 0; k < 4; k++)
+                        {
+                            prior[k] = static_cast<float>(prior_data[k]);
+                            if (!attrs.variance_encoded_in_target)
+                            {
+                                variance[k] = static_cast<float>(
+                                    image_priors[num_priors * prior_size + p * 4 + k]);
+                            }
+                        }
+                        if (!attrs.normalized)
+                        {
+                            prior[0] /= attrs.input_width;
+                            prior[1] /= attrs.input_height;
+                            prior[2] /= attrs.input_width;
+                            prior[3] /= attrs.input_height;
+                        }
+                        for (size_t c = 0; c < loc_classes; c++)
+                        {
+                            const T* loc_data =
+                                location + ((image * num_priors + p) * loc_classes + c) * 4;
+                            float loc[4];
+                            for (size_t k = 0; k < 4; k++)
+                            {
+                                loc[k] = static_cast<float>(loc_data[k]);
+                            }
+                            detection::decode_box(
+                                prior,
+                                variance,
+                                loc,
+                                center_size,
+                                attrs.clip_before_nms,
+                                &boxes[((image * loc_classes + c) * num_priors + p) * 4]);
+                        }
+                    }
+                });
+
+                // Corner encoding reads [xmin, ymin, xmax, ymax] as [y1, x1, y2, x2], which
+                // leaves the overlaps unchanged
+                NMSParameters params;
+                params.max_candidates = attrs.top_k;
+                params.iou_threshold = attrs.nms_threshold;
+                params.score_threshold = attrs.confidence_threshold;
+                std::vector<std::vector<NMSSelection>> selected(images * classes);
+                parallel(images * classes, 1, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        size_t image = i / classes;
+                        size_t c = i % classes;
+                        if (static_cast<int>(c) == attrs.background_label_id)
+                        {
+                            continue;
+                        }
+                        size_t loc_class = attrs.share_location ? 0 : c;
+                        non_max_suppression_class(
+                            &boxes[(image * loc_classes + loc_class) * num_priors * 4],
+                            confidence + image * num_priors * classes + c,
+                            num_priors,
+                            classes,
+                            params,
+                            selected[i]);
+                    }
+                });
+
+                struct Detection
+                {
+                    size_t label;
+                    NMSSelection selection;
+                };
+                size_t row = 0;
+                for (size_t image = 0; image < images; image++)
+                {
+                    std::vector<Detection> detections;
+                    for (size_t c = 0; c < classes; c++)
+                    {
+                        for (const NMSSelection& selection : selected[image * classes + c])
+                        {
+                            detections.push_back({c, selection});
+                        }
+                    }
+                    int keep_top_k = attrs.keep_top_k.empty() ? -1 : attrs.keep_top_k[0];
+                    if (keep_top_k > -1 && detections.size() > static_cast<size_t>(keep_top_k))
+                    {
+                        std::stable_sort(detections.begin(),
+                                         detections.end(),
+                                         [](const Detection& a, const Detection& b) {
+                                             return a.selection.score > b.selection.score;
+                                         });
+                        detections.resize(keep_top_k);
+                        std::stable_sort(detections.begin(),
+                                         detections.end(),
+                                         [](const Detection& a, const Detection& b) {
+                                             return a.label < b.label;
+                                         });
+                    }
+                    for (const Detection& detection : detections)
+                    {
+                        if (row == out_rows)
+                        {
+                            break;
+                        }
+                        size_t loc_class = attrs.share_location ? 0 : detection.label;
+                        const float* box =
+                            &boxes[((image * loc_classes + loc_class) * num_priors +
+                                    detection.selection.box) *
+                                   4];
+                        T* out = output + row * 7;
+                        out[0] = static_cast<T>(image);
+                        out[1] = static_cast<T>(detection.label);
+                        out[2] = static_cast<T>(detection.selection.score);
+                        for (size_t k = 0; k < 4; k++)
+                        {
+                            float coordinate = box[k];
+                            if (attrs.clip_after_nms)
+                            {
+                                coordinate = std::max(0.0f, std::min(1.0f, coordinate));
+                            }
+                            out[3 + k] = static_cast<T>(coordinate);
+                        }
+                        row++;
+                    }
+                }
+                for (; row < out_rows; row++)
+                {
+                    T* out = output + row * 7;
+                    std::fill(out, out + 7, static_cast<T>(0));
+                    out[0] = static_cast<T>(-1);
+                }
+            }
+        }
+    }
+}
@@ -16,13 +16,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include <cfenv>
 #include <functional>
 #include "convolution.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -58,112 +61,95 @@ namespace ngraph
 
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
-                // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
-                // they're right up front.
-                Shape dot_axis_sizes(reduction_axes_count);
-                std::copy(arg1_shape.begin(),
-                          arg1_shape.begin() + reduction_axes_count,
-                          dot_axis_sizes.begin());
 
-                CoordinateTransform arg0_transform(arg0_shape);
-                CoordinateTransform arg1_transform(arg1_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                // Create coordinate transforms for arg0 and arg1 that throw away the dotted axes.
+                // With row-major layouts the dotted axes are the trailing axes of arg0 and the
+                // leading axes of arg1, so any dot is a matrix product of an [m, k] arg0 with a
+                // [k, n] arg1.
                 size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
-                size_t arg1_projected_rank = arg1_shape.size() - reduction_axes_count;
-
-                Shape arg0_projected_shape(arg0_projected_rank);
-                std::copy(arg0_shape.begin(),
-                          arg0_shape.begin() + arg0_projected_rank,
-                          arg0_projected_shape.begin());
-
-                Shape arg1_projected_shape(arg1_projected_rank);
-                std::copy(arg1_shape.begin() + reduction_axes_count,
-                          arg1_shape.end(),
-                          arg1_projected_shape.begin());
-
-                CoordinateTransform arg0_projected_transform(arg0_projected_shape);
-                CoordinateTransform arg1_projected_transform(arg1_projected_shape);
-
-                // Create a coordinate transform that allows us to iterate over all possible values
-                // for the dotted axes.
-                CoordinateTransform dot_axes_transform(dot_axis_sizes);
-
-                for (const Coordinate& arg0_projected_coord : arg0_projected_transform)
+                size_t m = shape_size(Shape(arg0_shape.begin(),
+                                            arg0_shape.begin() + arg0_projected_rank));
+                size_t k = shape_size(
+                    Shape(arg1_shape.begin(), arg1_shape.begin() + reduction_axes_count));
+                size_t n =
+                    shape_size(Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+                NGRAPH_CHECK(m * n == shape_size(out_shape), "Dot output shape mismatch");
+
+                ACCUMULATION arg0_offset = 0;
+                ACCUMULATION arg1_offset = 0;
+                float scale = 1;
+                if (is_quantized)
                 {
-                    for (const Coordinate& arg1_projected_coord : arg1_projected_transform)
-                    {
-                        // The output coordinate is just the concatenation of the projected
-                        // coordinates.
-                        Coordinate out_coord(arg0_projected_coord.size() +
-                                             arg1_projected_coord.size());
-
-                        auto out_coord_it = std::copy(arg0_projected_coord.begin(),
-                                                      arg0_projected_coord.end(),
-                                                      out_coord.begin());
-                        std::copy(
-                            arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
-
-                        // Zero out to start the sum.
-                        ACCUMULATION sum = 0;
-
-                        size_t out_index = output_transform.index(out_coord);
+                    arg0_offset = static_cast<ACCUMULATION>(*input0_zero_point);
+                    arg1_offset = static_cast<ACCUMULATION>(*input1_zero_point);
+                    scale = *input0_scale * *input1_scale / *output_scale;
+                }
 
-                        // Walk along the dotted axes.
-                        Coordinate arg0_coord(arg0_shape.size());
-                        Coordinate arg1_coord(arg1_shape.size());
-                        auto arg0_it = std::copy(arg0_projected_coord.begin(),
-                                                 arg0_projected_coord.end(),
-                                                 arg0_coord.begin());
-                        for (const Coordinate& dot_axis_positions : dot_axes_transform)
+                // Output is computed in blocks of rows and columns, walking the reduction axis
+                // in chunks so the touched slice of arg1 stays in cache. Each output element
+                // still accumulates its products in increasing reduction order, so results match
+                // a plain triple loop exactly.
+                const size_t row_block = 16;
+                const size_t col_block = 128;
+                const size_t red_block = 256;
+                size_t row_blocks = (m + row_block - 1) / row_block;
+                size_t col_blocks = (n + col_block - 1) / col_block;
+                size_t block_work = row_block * col_block * std::max<size_t>(k, 1);
+                size_t grain = std::max<size_t>(1, (size_t(1) << 16) / block_work);
+
+                parallel_for(row_blocks * col_blocks, grain, [&](size_t begin, size_t end) {
+                    std::vector<ACCUMULATION> acc(row_block * col_block);
+                    for (size_t block = begin; block < end; block++)
+                    {
+                        size_t row_begin = (block / col_blocks) * row_block;
+                        size_t row_end = std::min(row_begin + row_block, m);
+                        size_t col_begin = (block % col_blocks) * col_block;
+                        size_t col_end = std::min(col_begin + col_block, n);
+                        size_t cols = col_end - col_begin;
+
+                        std::fill(acc.begin(), acc.end(), ACCUMULATION(0));
+                        for (size_t red_begin = 0; red_begin < k; red_begin += red_block)
                         {
-                            // In order to find the points to multiply together, we need to inject
-                            // our current positions along the dotted axes back into the projected
-                            // arg0 and arg1 coordinates.
-                            std::copy(
-                                dot_axis_positions.begin(), dot_axis_positions.end(), arg0_it);
-
-                            auto arg1_it = std::copy(dot_axis_positions.begin(),
-                                                     dot_axis_positions.end(),
-                                                     arg1_coord.begin());
-                            std::copy(
-                                arg1_projected_coord.begin(), arg1_projected_coord.end(), arg1_it);
-
-                            // Multiply and add to the sum.
-                            if (is_quantized)
-                            {
-                                sum += (static_cast<ACCUMULATION>(
-                                            arg0[arg0_transform.index(arg0_coord)]) -
-                                        static_cast<ACCUMULATION>(*input0_zero_point)) *
-                                       (static_cast<ACCUMULATION>(
-                                            arg1[arg1_transform.index(arg1_coord)]) -
-                                        static_cast<ACCUMULATION>(*input1_zero_point));
-                            }
-                            else
+                            size_t red_end = std::min(red_begin + red_block, k);
+                            for (size_t i = row_begin; i < row_end; i++)
                             {
-                                sum += static_cast<ACCUMULATION>(
-                                           arg0[arg0_transform.index(arg0_coord)]) *
-                                       static_cast<ACCUMULATION>(
-                                           arg1[arg1_transform.index(arg1_coord)]);
+                                ACCUMULATION* acc_row = &acc[(i - row_begin) * col_block];
+                                const INPUT0* arg0_row = arg0 + i * k;
+                                for (size_t r = red_begin; r < red_end; r++)
+                                {
+                                    ACCUMULATION a =
+                                        static_cast<ACCUMULATION>(arg0_row[r]) - arg0_offset;
+                                    const INPUT1* arg1_row = arg1 + r * n + col_begin;
+                                    for (size_t j = 0; j < cols; j++)
+                                    {
+                                        acc_row[j] +=
+                                            a * (static_cast<ACCUMULATION>(arg1_row[j]) -
+                                                 arg1_offset);
+                                    }
+                                }
                             }
                         }
 
-                        if (is_quantized)
+                        for (size_t i = row_begin; i < row_end; i++)
                         {
-                            float scale = *input0_scale * *input1_scale / *output_scale;
-                            // Write the sum back.
-                            out[out_index] =
-                                static_cast<OUTPUT>(std::round(static_cast<float>(sum) * scale)) +
-                                *output_zero_point;
-                        }
-                        else
-                        {
-                            out[out_index] = sum;
+                            const ACCUMULATION* acc_row = &acc[(i - row_begin) * col_block];
+                            OUTPUT* out_row = out + i * n + col_begin;
+                            for (size_t j = 0; j < cols; j++)
+                            {
+                                if (is_quantized)
+                                {
+                                    out_row[j] = static_cast<OUTPUT>(std::round(
+                                                     static_cast<float>(acc_row[j]) * scale)) +
+                                                 *output_zero_point;
+                                }
+                                else
+                                {
+                                    out_row[j] = acc_row[j];
+                                }
+                            }
                         }
                     }
-                    std::fesetround(old_mode);
-                }
+                });
+                std::fesetround(old_mode);
             }
         }
     }
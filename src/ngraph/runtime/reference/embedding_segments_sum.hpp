@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/reference/embeddingbag_offsets_sum.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief EmbeddingSegmentsSum: segment s sums the rows of the indices whose
+            ///        segment id is s.
+            ///
+            /// Segment ids are expected to be sorted, in which case each segment is a
+            /// contiguous run of lookups. Unsorted ids are grouped by a counting sort first,
+            /// keeping the lookups of a segment in their original order.
+            ///
+            /// \param default_index Row for empty segments, null to fill them with zeros
+            /// \param weights Per-sample weights matching indices, null for unweighted sums
+            /// \param parallel Runs the parallel loops, runtime::parallel_for by default
+            template <typename T, typename I>
+            void embedding_segments_sum(const T* table,
+                                        const Shape& table_shape,
+                                        const I* indices,
+                                        size_t num_indices,
+                                        const I* segment_ids,
+                                        size_t num_segments,
+                                        const I* default_index,
+                                        const T* weights,
+                                        T* out,
+                                        const ParallelFor& parallel = parallel_for)
+            {
+                std::vector<size_t> bounds(num_segments + 1, 0);
+                bool sorted = true;
+                for (size_t i = 0; i < num_indices; i++)
+                {
+                    NGRAPH_CHECK(segment_ids[i] >= 0 &&
+                                     static_cast<size_t>(segment_ids[i]) < num_segments,
+                                 "EmbeddingSegmentsSum segment id ",
+                                 static_cast<int64_t>(segment_ids[i]),
+                                 " is out of range [0, ",
+                                 num_segments,
+                                 ")");
+                    bounds[segment_ids[i] + 1]++;
+                    sorted = sorted && (i == 0 || segment_ids[i] >= segment_ids[i - 1]);
+                }
+                for (size_t s = 0; s < num_segments; s++)
+                {
+                    bounds[s + 1] += bounds[s];
+                }
+
+                std::vector<size_t> order;
+                if (!sorted)
+                {
+                    order.resize(num_indices);
+                    std::vector<size_t> next(bounds.begin(), bounds.end() - 1);
+                    for (size_t i = 0; i < num_indices; i++)
+                    {
+                        order[next[segment_ids[i]]++] = i;
+                    }
+                }
+                embedding_bag_sum(table,
+                                  table_shape,
+                                  indices,
+                                  weights,
+                                  bounds.data(),
+                                  sorted ? nullptr : order.data(),
+                                  num_segments,
+                                  default_index ? static_cast<int64_t>(*default_index) : -1,
+                                  out,
+                                  parallel);
+            }
+        }
+    }
+}
@@ -0,0 +1,223 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/bfloat16.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace embedding_bag
+            {
+                // bf16 rows are summed in float so long bags do not lose the low bits
+                template <typename T>
+                struct Accumulator
+                {
+                    using type = T;
+                };
+
+                template <>
+                struct Accumulator<bfloat16>
+                {
+                    using type = float;
+                };
+
+                // Rows this many lookups ahead are prefetched while the current one is summed
+                constexpr size_t prefetch_distance = 4;
+                // Cap on the bytes prefetched per row, wide rows stream well enough unaided
+                constexpr size_t prefetch_bytes = 1024;
+
+                inline void prefetch_row(const void* row, size_t bytes)
+                {
+#if defined(__GNUC__)
+                    const char* p = static_cast<const char*>(row);
+                    for (size_t offset = 0; offset < std::min(bytes, prefetch_bytes);
+                         offset += 64)
+                    {
+                        __builtin_prefetch(p + offset);
+                    }
+#else
+                    (void)row;
+                    (void)bytes;
+#endif
+                }
+            }
+
+            /// \brief Sums rows of an embedding table over bags of indices, in parallel over
+            ///        the bags and without materializing the gathered rows.
+            ///
+            /// Bag b covers lookups bounds[b] to bounds[b + 1]. Lookup k reads index
+            /// order[k], or k when order is null, and is scaled by the matching per-sample
+            /// weight when weights is not null. An empty bag gets the default_index row, or
+            /// zeros when default_index is negative.
+            ///
+            /// \param table Embedding table of shape [num_emb, emb_dim1, ...]
+            /// \param bounds num_bags + 1 non-decreasing lookup positions
+            /// \param parallel Runs the parallel loops, runtime::parallel_for by default
+            template <typename T, typename I>
+            void embedding_bag_sum(const T* table,
+                                   const Shape& table_shape,
+                                   const I* indices,
+                                   const T* weights,
+                                   const size_t* bounds,
+                                   const size_t* order,
+                                   size_t num_bags,
+                                   int64_t default_index,
+                                   T* out,
+                                   const ParallelFor& parallel = parallel_for)
+            {
+                using ACCUMULATION = typename embedding_bag::Accumulator<T>::type;
+                if (num_bags == 0)
+                {
+                    return;
+                }
+                size_t num_rows = table_shape.at(0);
+                size_t row_size = shape_size(table_shape) / std::max<size_t>(num_rows, 1);
+                size_t num_lookups = bounds[num_bags];
+
+                // Checked up front so the parallel loop cannot read outside the table
+                for (size_t i = 0; i < num_lookups; i++)
+                {
+                    NGRAPH_CHECK(indices[i] >= 0 && static_cast<size_t>(indices[i]) < num_rows,
+                                 "Embedding index ",
+                                 static_cast<int64_t>(indices[i]),
+                                 " is out of range [0, ",
+                                 num_rows,
+                                 ")");
+                }
+                NGRAPH_CHECK(default_index < static_cast<int64_t>(num_rows),
+                             "Embedding default index ",
+                             default_index,
+                             " is out of range [0, ",
+                             num_rows,
+                             ")");
+
+                size_t average_work = row_size * std::max<size_t>(1, num_lookups / num_bags);
+                size_t grain =
+                    std::max<size_t>(1, (size_t(1) << 14) / std::max<size_t>(average_work, 1));
+                parallel(num_bags, grain, [&](size_t begin, size_t end) {
+                    std::vector<ACCUMULATION> acc(row_size);
+                    for (size_t b = begin; b < end; b++)
+                    {
+                        T* out_row = out + b * row_size;
+                        size_t first = bounds[b];
+                        size_t last = bounds[b + 1];
+                        if (first == last)
+                        {
+                            if (default_index < 0)
+                            {
+                                std::fill(out_row, out_row + row_size, T(0));
+                            }
+                            else
+                            {
+                                const T* row = table + default_index * row_size;
+                                std::copy(row, row + row_size, out_row);
+                            }
+                            continue;
+                        }
+
+                        std::fill(acc.begin(), acc.end(), ACCUMULATION(0));
+                        for (size_t k = first; k < last; k++)
+                        {
+                            if (k + embedding_bag::prefetch_distance < last)
+                            {
+                                size_t ahead = k + embedding_bag::prefetch_distance;
+                                size_t index = order ? order[ahead] : ahead;
+                                embedding_bag::prefetch_row(
+                                    table + static_cast<size_t>(indices[index]) * row_size,
+                                    row_size * sizeof(T));
+                            }
+                            size_t index = order ? order[k] : k;
+                            const T* row = table + static_cast<size_t>(indices[index]) * row_size;
+                            if (weights)
+                            {
+                                ACCUMULATION weight = static_cast<ACCUMULATION>(weights[index]);
+                                for (size_t j = 0; j < row_size; j++)
+                                {
+                                    acc[j] += weight * static_cast<ACCUMULATION>(row[j]);
+                                }
+                            }
+                            else
+                            {
+                                for (size_t j = 0; j < row_size; j++)
+                                {
+                                    acc[j] += static_cast<ACCUMULATION>(row[j]);
+                                }
+                            }
+                        }
+                        for (size_t j = 0; j < row_size; j++)
+                        {
+                            out_row[j] = static_cast<T>(acc[j]);
+                        }
+                    }
+                });
+            }
+
+            /// \brief EmbeddingBagOffsetsSum: bag b sums the rows of indices offsets[b] up to
+            ///        offsets[b + 1], the last bag running to the end of indices.
+            ///
+            /// \param default_index Row for empty bags, null to fill them with zeros
+            /// \param weights Per-sample weights matching indices, null for unweighted sums
+            /// \param parallel Runs the parallel loops, runtime::parallel_for by default
+            template <typename T, typename I>
+            void embeddingbag_offsets_sum(const T* table,
+                                          const Shape& table_shape,
+                                          const I* indices,
+                                          size_t num_indices,
+                                          const I* offsets,
+                                          size_t num_bags,
+                                          const I* default_index,
+                                          const T* weights,
+                                          T* out,
+                                          const ParallelFor& parallel = parallel_for)
+            {
+                std::vector<size_t> bounds(num_bags + 1);
+                for (size_t b = 0; b < num_bags; b++)
+                {
+                    NGRAPH_CHECK(offsets[b] >= 0 &&
+                                     static_cast<size_t>(offsets[b]) <= num_indices &&
+                                     (b == 0 || offsets[b] >= offsets[b - 1]),
+                                 "EmbeddingBagOffsetsSum offsets must be non-decreasing and "
+                                 "within the indices");
+                    bounds[b] = static_cast<size_t>(offsets[b]);
+                }
+                bounds[num_bags] = num_indices;
+                embedding_bag_sum(table,
+                                  table_shape,
+                                  indices,
+                                  weights,
+                                  bounds.data(),
+                                  nullptr,
+                                  num_bags,
+                                  default_index ? static_cast<int64_t>(*default_index) : -1,
+                                  out,
+                                  parallel);
+            }
+        }
+    }
+}
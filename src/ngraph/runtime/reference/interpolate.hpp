@@ -0,0 +1,207 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/op/interpolate.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace resize
+            {
+                /// \brief Source rows of every output index along one resized axis. Output
+                ///        index o blends rows low[o] and high[o] with weight[o] on high[o].
+                struct AxisTable
+                {
+                    std::vector<size_t> low;
+                    std::vector<size_t> high;
+                    std::vector<float> weight;
+                };
+
+                inline AxisTable make_axis_table(size_t in_size,
+                                                 size_t out_size,
+                                                 bool linear,
+                                                 bool align_corners)
+                {
+                    AxisTable table;
+                    table.low.resize(out_size);
+                    table.high.resize(out_size);
+                    table.weight.resize(out_size);
+                    float scale = static_cast<float>(in_size) / out_size;
+                    float corner_scale =
+                        out_size > 1 ? static_cast<float>(in_size - 1) / (out_size - 1) : 0.0f;
+                    for (size_t o = 0; o < out_size; o++)
+                    {
+                        float x;
+                        if (align_corners)
+                        {
+                            x = o * corner_scale;
+                        }
+                        else if (linear)
+                        {
+                            x = std::max(0.0f, (o + 0.5f) * scale - 0.5f);
+                        }
+                        else
+                        {
+                            x = o * scale;
+                        }
+
+                        if (linear)
+                        {
+                            size_t low = std::min(static_cast<size_t>(x), in_size - 1);
+                            table.low[o] = low;
+                            table.high[o] = std::min(low + 1, in_size - 1);
+                            table.weight[o] = table.high[o] == low ? 0.0f : x - low;
+                        }
+                        else
+                        {
+                            size_t nearest = static_cast<size_t>(align_corners ? std::round(x)
+                                                                               : std::floor(x));
+                            table.low[o] = std::min(nearest, in_size - 1);
+                            table.high[o] = table.low[o];
+                            table.weight[o] = 0.0f;
+                        }
+                    }
+                    return table;
+                }
+
+                /// \brief Resizes the middle axis of an [outer, in_size, inner] tensor. Rows of
+                ///        inner elements are contiguous, so each output row is a copy or a
+                ///        blend of two input rows. Blends of integer inputs are rounded.
+                template <typename T>
+                void resize_axis(const T* arg,
+                                 T* out,
+                                 size_t outer,
+                                 size_t in_size,
+                                 size_t inner,
+                                 const AxisTable& table,
+                                 const ParallelFor& parallel)
+                {
+                    size_t out_size = table.low.size();
+                    size_t grain =
+                        std::max<size_t>(1, (size_t(1) << 14) / std::max<size_t>(inner, 1));
+                    parallel(outer * out_size, grain, [&](size_t begin, size_t end) {
+                        for (size_t row = begin; row < end; row++)
+                        {
+                            size_t o = row % out_size;
+                            size_t base = (row / out_size) * in_size;
+                            const T* a = arg + (base + table.low[o]) * inner;
+                            const T* b = arg + (base + table.high[o]) * inner;
+                            T* dst = out + row * inner;
+                            float w = table.weight[o];
+                            if (w == 0.0f)
+                            {
+                                std::copy(a, a + inner, dst);
+                            }
+                            else
+                            {
+                                for (size_t i = 0; i < inner; i++)
+                                {
+                                    auto value = (1.0f - w) * a[i] + w * b[i];
+                                    dst[i] = static_cast<T>(
+                                        std::is_integral<T>::value ? std::round(value) : value);
+                                }
+                            }
+                        }
+                    });
+                }
+            }
+
+            /// \brief v0 Interpolate in nearest or linear mode.
+            ///
+            /// Both modes are separable, so the resize runs as one pass per resized axis over
+            /// precomputed index and weight tables, shrinking axes first to keep the
+            /// intermediate tensors small. Multi-axis linear mode is the usual bilinear or
+            /// trilinear blend.
+            /// \param parallel Runs the parallel loops, runtime::parallel_for by default
+            template <typename T>
+            void interpolate(const T* arg,
+                             T* out,
+                             const Shape& arg_shape,
+                             const Shape& out_shape,
+                             const op::v0::InterpolateAttrs& attrs,
+                             const ParallelFor& parallel = parallel_for)
+            {
+                NGRAPH_CHECK(attrs.mode == "nearest" || attrs.mode == "linear",
+                             "Interpolate mode '",
+                             attrs.mode,
+                             "' is not supported");
+                NGRAPH_CHECK(!attrs.antialias, "Interpolate antialiasing is not supported");
+                NGRAPH_CHECK(std::all_of(attrs.pads_begin.begin(),
+                                         attrs.pads_begin.end(),
+                                         [](size_t pad) { return pad == 0; }) &&
+                                 std::all_of(attrs.pads_end.begin(),
+                                             attrs.pads_end.end(),
+                                             [](size_t pad) { return pad == 0; }),
+                             "Interpolate padding is not supported");
+                bool linear = attrs.mode == "linear";
+
+                std::vector<size_t> axes;
+                for (size_t axis : attrs.axes)
+                {
+                    if (arg_shape[axis] != out_shape[axis])
+                    {
+                        axes.push_back(axis);
+                    }
+                }
+                std::sort(axes.begin(), axes.end(), [&](size_t a, size_t b) {
+                    return out_shape[a] * arg_shape[b] < out_shape[b] * arg_shape[a];
+                });
+                if (axes.empty())
+                {
+                    std::copy(arg, arg + shape_size(arg_shape), out);
+                    return;
+                }
+
+                Shape shape = arg_shape;
+                std::vector<T> buffers[2];
+                const T* src = arg;
+                for (size_t pass = 0; pass < axes.size(); pass++)
+                {
+                    size_t axis = axes[pass];
+                    size_t outer = shape_size(Shape(shape.begin(), shape.begin() + axis));
+                    size_t inner = shape_size(Shape(shape.begin() + axis + 1, shape.end()));
+                    size_t in_size = shape[axis];
+                    resize::AxisTable table = resize::make_axis_table(
+                        in_size, out_shape[axis], linear, attrs.align_corners);
+                    shape[axis] = out_shape[axis];
+
+                    T* dst = out;
+                    if (pass + 1 < axes.size())
+                    {
+                        buffers[pass % 2].resize(shape_size(shape));
+                        dst = buffers[pass % 2].data();
+                    }
+                    resize::resize_axis(src, dst, outer, in_size, inner, table, parallel);
+                    src = dst;
+                }
+            }
+        }
+    }
+}
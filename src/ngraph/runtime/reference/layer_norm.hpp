@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Normalizes rows [row_begin, row_end) of a rows x cols matrix, computing
+            ///        each row's mean and (biased) variance in one Welford pass.
+            ///
+            /// scale and bias hold cols elements each and may both be nullptr; mean and
+            /// variance hold one element per row and may both be nullptr.
+            template <typename T>
+            void layer_norm_rows(const T* data,
+                                 const T* scale,
+                                 const T* bias,
+                                 T* out,
+                                 T* mean,
+                                 T* variance,
+                                 size_t row_begin,
+                                 size_t row_end,
+                                 size_t cols,
+                                 double epsilon)
+            {
+                for (size_t row = row_begin; row < row_end; row++)
+                {
+                    const T* x = data + row * cols;
+                    T* y = out + row * cols;
+
+                    double m = 0;
+                    double m2 = 0;
+                    for (size_t j = 0; j < cols; j++)
+                    {
+                        double value = static_cast<double>(x[j]);
+                        double delta = value - m;
+                        m += delta / static_cast<double>(j + 1);
+                        m2 += delta * (value - m);
+                    }
+                    double var = m2 / static_cast<double>(cols);
+                    double inv_stddev = 1.0 / std::sqrt(var + epsilon);
+
+                    for (size_t j = 0; j < cols; j++)
+                    {
+                        double norm = (static_cast<double>(x[j]) - m) * inv_stddev;
+                        if (scale != nullptr)
+                        {
+                            norm = norm * static_cast<double>(scale[j]) +
+                                   static_cast<double>(bias[j]);
+                        }
+                        y[j] = static_cast<T>(norm);
+                    }
+                    if (mean != nullptr)
+                    {
+                        mean[row] = static_cast<T>(m);
+                        variance[row] = static_cast<T>(var);
+                    }
+                }
+            }
+
+            /// \brief LayerNorm over the axes of shape from begin_norm_axis onwards.
+            template <typename T>
+            void layer_norm(const T* data,
+                            const T* scale,
+                            const T* bias,
+                            T* out,
+                            T* mean,
+                            T* variance,
+                            const Shape& shape,
+                            size_t begin_norm_axis,
+                            double epsilon)
+            {
+                size_t rows = 1;
+                size_t cols = 1;
+                for (size_t i = 0; i < shape.size(); i++)
+                {
+                    (i < begin_norm_axis ? rows : cols) *= shape[i];
+                }
+                layer_norm_rows(data, scale, bias, out, mean, variance, 0, rows, cols, epsilon);
+            }
+        }
+    }
+}
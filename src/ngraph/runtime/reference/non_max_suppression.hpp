@@ -0,0 +1,308 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief A box kept by non-max suppression and its score after any soft-NMS decay.
+            struct NMSSelection
+            {
+                int64_t box;
+                float score;
+            };
+
+            /// \brief Tuning of the per-class selection shared by NonMaxSuppression and
+            ///        DetectionOutput.
+            struct NMSParameters
+            {
+                /// Whether boxes are [x_center, y_center, width, height] rather than two
+                /// opposite corners
+                bool center_encoding = false;
+                /// Most boxes selected per class, negative for no limit
+                int64_t max_selected = -1;
+                /// Most candidates considered per class in score order, negative for no limit
+                int64_t max_candidates = -1;
+                /// A box overlapping a selected one by more than this is dropped
+                float iou_threshold = 0.0f;
+                /// Only boxes scoring above this are candidates
+                float score_threshold = 0.0f;
+                /// When positive, overlapping boxes have their score decayed by
+                /// exp(-0.5 * iou^2 / sigma) instead of only being dropped past the threshold
+                float soft_nms_sigma = 0.0f;
+            };
+
+            namespace nms
+            {
+                struct Corners
+                {
+                    float y1;
+                    float x1;
+                    float y2;
+                    float x2;
+                    float area;
+                };
+
+                template <typename T>
+                Corners get_corners(const T* box, bool center_encoding)
+                {
+                    Corners c;
+                    if (center_encoding)
+                    {
+                        float half_w = static_cast<float>(box[2]) / 2;
+                        float half_h = static_cast<float>(box[3]) / 2;
+                        c.x1 = static_cast<float>(box[0]) - half_w;
+                        c.x2 = static_cast<float>(box[0]) + half_w;
+                        c.y1 = static_cast<float>(box[1]) - half_h;
+                        c.y2 = static_cast<float>(box[1]) + half_h;
+                    }
+                    else
+                    {
+                        c.y1 = std::min<float>(box[0], box[2]);
+                        c.y2 = std::max<float>(box[0], box[2]);
+                        c.x1 = std::min<float>(box[1], box[3]);
+                        c.x2 = std::max<float>(box[1], box[3]);
+                    }
+                    c.area = (c.y2 - c.y1) * (c.x2 - c.x1);
+                    return c;
+                }
+
+                inline float intersection_over_union(const Corners& a, const Corners& b)
+                {
+                    if (a.area <= 0 || b.area <= 0)
+                    {
+                        return 0;
+                    }
+                    float h = std::min(a.y2, b.y2) - std::max(a.y1, b.y1);
+                    float w = std::min(a.x2, b.x2) - std::max(a.x1, b.x1);
+                    if (h <= 0 || w <= 0)
+                    {
+                        return 0;
+                    }
+                    float intersection = h * w;
+                    return intersection / (a.area + b.area - intersection);
+                }
+
+                struct Candidate
+                {
+                    int64_t box;
+                    float score;
+                    // Selected boxes before this index have already been applied to score
+                    size_t suppress_begin;
+                };
+
+                // Highest score first, lowest box index among equal scores
+                struct CandidateOrder
+                {
+                    bool operator()(const Candidate& a, const Candidate& b) const
+                    {
+                        return a.score < b.score || (a.score == b.score && a.box > b.box);
+                    }
+                };
+            }
+
+            /// \brief Selects boxes of one class, highest score first.
+            ///
+            /// Candidates sit in a heap rather than being fully sorted, so a class stops
+            /// costing work as soon as max_selected boxes are kept or max_candidates have been
+            /// tried. A candidate is only compared against the boxes selected since it was last
+            /// looked at; with soft-NMS a candidate whose score decayed is pushed back and
+            /// selected once it is again the best remaining.
+            ///
+            /// \param boxes num_boxes boxes of four coordinates each
+            /// \param scores Score of box i at scores[i * score_stride]
+            template <typename TBox, typename TScore>
+            void non_max_suppression_class(const TBox* boxes,
+                                           const TScore* scores,
+                                           size_t num_boxes,
+                                           size_t score_stride,
+                                           const NMSParameters& params,
+                                           std::vector<NMSSelection>& selected)
+            {
+                selected.clear();
+                if (params.max_selected == 0 || params.max_candidates == 0)
+                {
+                    return;
+                }
+
+                std::vector<nms::Candidate> heap;
+                for (size_t i = 0; i < num_boxes; i++)
+                {
+                    float score = static_cast<float>(scores[i * score_stride]);
+                    if (score > params.score_threshold)
+                    {
+                        heap.push_back({static_cast<int64_t>(i), score, 0});
+                    }
+                }
+                std::priority_queue<nms::Candidate,
+                                    std::vector<nms::Candidate>,
+                                    nms::CandidateOrder>
+                    candidates(nms::CandidateOrder(), std::move(heap));
+
+                bool soft = params.soft_nms_sigma > 0;
+                float decay_scale = soft ? -0.5f / params.soft_nms_sigma : 0.0f;
+                size_t max_selected = params.max_selected < 0
+                                          ? num_boxes
+                                          : static_cast<size_t>(params.max_selected);
+                size_t candidates_left = params.max_candidates < 0
+                                             ? num_boxes
+                                             : static_cast<size_t>(params.max_candidates);
+                std::vector<nms::Corners> selected_corners;
+                while (selected.size() < max_selected && !candidates.empty())
+                {
+                    nms::Candidate candidate = candidates.top();
+                    candidates.pop();
+                    if (candidate.suppress_begin == 0)
+                    {
+                        // First time this box is looked at. Decayed candidates pushed back
+                        // earlier were already counted, so they are still tried once the
+                        // budget runs out.
+                        if (candidates_left == 0)
+                        {
+                            continue;
+                        }
+                        candidates_left--;
+                    }
+
+                    nms::Corners corners =
+                        nms::get_corners(boxes + 4 * candidate.box, params.center_encoding);
+                    float original_score = candidate.score;
+                    bool suppressed = false;
+                    for (size_t j = candidate.suppress_begin; j < selected_corners.size(); j++)
+                    {
+                        float iou = nms::intersection_over_union(corners, selected_corners[j]);
+                        if (iou > params.iou_threshold)
+                        {
+                            suppressed = true;
+                            break;
+                        }
+                        if (soft)
+                        {
+                            candidate.score *= std::exp(decay_scale * iou * iou);
+                            if (candidate.score <= params.score_threshold)
+                            {
+                                suppressed = true;
+                                break;
+                            }
+                        }
+                    }
+                    if (suppressed)
+                    {
+                        continue;
+                    }
+                    if (candidate.score == original_score)
+                    {
+                        selected.push_back({candidate.box, candidate.score});
+                        selected_corners.push_back(corners);
+                    }
+                    else
+                    {
+                        candidate.suppress_begin = selected_corners.size();
+                        candidates.push(candidate);
+                    }
+                }
+            }
+
+            /// \brief NonMaxSuppression over boxes [batches, num_boxes, 4] and scores
+            ///        [batches, classes, num_boxes], with classes processed in parallel.
+            ///
+            /// Writes [batch, class, box] triplets to the output_rows rows of output, ordered
+            /// by descending score when sort_result_descending is set and by batch, class and
+            /// descending score otherwise. Rows past the selected boxes are filled with -1.
+            ///
+            /// Selections past output_rows are dropped. NonMaxSuppression infers
+            /// min(num_boxes, max_output_boxes_per_class * classes) rows, which does not scale
+            /// with batches, so with several batches the later batches, or the lowest scores
+            /// when sort_result_descending is set, can be cut off.
+            /// \param parallel Runs the parallel loops, runtime::parallel_for by default
+            template <typename T, typename I>
+            void non_max_suppression(const T* boxes,
+                                     const T* scores,
+                                     const Shape& scores_shape,
+                                     const NMSParameters& params,
+                                     bool sort_result_descending,
+                                     I* output,
+                                     size_t output_rows,
+                                     const ParallelFor& parallel = parallel_for)
+            {
+                size_t batches = scores_shape[0];
+                size_t classes = scores_shape[1];
+                size_t num_boxes = scores_shape[2];
+
+                std::vector<std::vector<NMSSelection>> selected(batches * classes);
+                parallel(batches * classes, 1, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        size_t batch = i / classes;
+                        non_max_suppression_class(boxes + batch * num_boxes * 4,
+                                                  scores + i * num_boxes,
+                                                  num_boxes,
+                                                  1,
+                                                  params,
+                                                  selected[i]);
+                    }
+                });
+
+                struct Triplet
+                {
+                    int64_t batch;
+                    int64_t cls;
+                    NMSSelection selection;
+                };
+                std::vector<Triplet> triplets;
+                for (size_t i = 0; i < selected.size(); i++)
+                {
+                    for (const NMSSelection& selection : selected[i])
+                    {
+                        triplets.push_back({static_cast<int64_t>(i / classes),
+                                            static_cast<int64_t>(i % classes),
+                                            selection});
+                    }
+                }
+                if (sort_result_descending)
+                {
+                    std::stable_sort(
+                        triplets.begin(), triplets.end(), [](const Triplet& a, const Triplet& b) {
+                            return a.selection.score > b.selection.score;
+                        });
+                }
+
+                size_t rows = std::min(triplets.size(), output_rows);
+                for (size_t i = 0; i < rows; i++)
+                {
+                    output[3 * i] = static_cast<I>(triplets[i].batch);
+                    output[3 * i + 1] = static_cast<I>(triplets[i].cls);
+                    output[3 * i + 2] = static_cast<I>(triplets[i].selection.box);
+                }
+                std::fill(output + 3 * rows, output + 3 * output_rows, static_cast<I>(-1));
+            }
+        }
+    }
+}
@@ -16,12 +16,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/pad.hpp" // for op::PadMode
+#include "ngraph/runtime/reference/copy.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strided_offset_iterator.hpp"
 
 namespace ngraph
 {
@@ -39,6 +44,41 @@ namespace ngraph
                      const CoordinateDiff& padding_above,
                      op::PadMode pad_mode)
             {
+                if (pad_mode == op::PadMode::CONSTANT)
+                {
+                    // Fill with the pad value, then copy the part of arg0 that lands inside out.
+                    // Negative padding crops arg0.
+                    std::fill(out, out + shape_size(out_shape), *arg1);
+
+                    std::vector<std::ptrdiff_t> arg0_strides =
+                        StridedOffsetIterator::row_major_strides(arg0_shape);
+                    std::vector<std::ptrdiff_t> out_strides =
+                        StridedOffsetIterator::row_major_strides(out_shape);
+                    Shape copy_shape(arg0_shape.size());
+                    std::ptrdiff_t arg0_start = 0;
+                    std::ptrdiff_t out_start = 0;
+                    for (size_t i = 0; i < arg0_shape.size(); i++)
+                    {
+                        std::ptrdiff_t begin = std::max<std::ptrdiff_t>(0, -padding_below[i]);
+                        std::ptrdiff_t end =
+                            std::min(static_cast<std::ptrdiff_t>(arg0_shape[i]),
+                                     static_cast<std::ptrdiff_t>(out_shape[i]) - padding_below[i]);
+                        if (end <= begin)
+                        {
+                            return;
+                        }
+                        copy_shape[i] = static_cast<size_t>(end - begin);
+                        arg0_start += begin * arg0_strides[i];
+                        out_start += (begin + padding_below[i]) * out_strides[i];
+                    }
+
+                    strided_copy(arg0,
+                                 out,
+                                 StridedOffsetIterator(
+                                     copy_shape, arg0_strides, arg0_start, out_strides, out_start));
+                    return;
+                }
+
                 Coordinate input_start(arg0_shape.size(), 0); // start at (0,0,...,0)
                 Coordinate input_end = out_shape; // end at (d'0,d'1,...,d'n), the outer corner of
                                                   // the post-padding shape
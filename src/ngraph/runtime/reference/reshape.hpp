@@ -21,6 +21,8 @@
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/copy.hpp"
+#include "ngraph/strided_offset_iterator.hpp"
 
 namespace ngraph
 {
@@ -35,30 +37,20 @@ namespace ngraph
                          const AxisVector& in_axis_order,
                          const Shape& out_shape)
             {
-                // Unfortunately we don't yet have a constructor for CoordinateTransform that lets
-                // us pass only source_space_shape
-                // and source_axis_order so we have to construct the defaults here.
-                Shape in_start_corner(in_shape.size(), 0); // (0,...0)
-                Strides in_strides(in_shape.size(), 1);    // (1,...,1)
-
-                CoordinateTransform input_transform(
-                    in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
-                CoordinateTransform output_transform(out_shape);
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                NGRAPH_CHECK(shape_size(in_shape) == shape_size(out_shape));
+
+                // Walk the input in in_axis_order; the output is filled sequentially
+                std::vector<std::ptrdiff_t> in_strides =
+                    StridedOffsetIterator::row_major_strides(in_shape);
+                Shape walk_shape(in_shape.size());
+                std::vector<std::ptrdiff_t> walk_strides(in_shape.size());
+                for (size_t i = 0; i < in_axis_order.size(); i++)
                 {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-
-                    ++output_it;
+                    walk_shape[i] = in_shape[in_axis_order[i]];
+                    walk_strides[i] = in_strides[in_axis_order[i]];
                 }
+
+                strided_copy(arg, out, StridedOffsetIterator(walk_shape, walk_strides));
             }
         }
     }
@@ -18,7 +18,10 @@
 
 #include <cmath>
 
+#include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/copy.hpp"
+#include "ngraph/strided_offset_iterator.hpp"
 
 namespace ngraph
 {
@@ -35,23 +38,23 @@ namespace ngraph
             {
                 // In fact arg_shape == out_shape, but we'll use both for stylistic consistency with
                 // other kernels.
-                CoordinateTransform arg_transform(arg_shape);
-                CoordinateTransform output_transform(out_shape);
+                NGRAPH_CHECK(shape_size(arg_shape) == shape_size(out_shape));
 
-                for (Coordinate out_coord : output_transform)
+                // Reversed axes are walked from their last element with a negated stride
+                std::vector<std::ptrdiff_t> arg_strides =
+                    StridedOffsetIterator::row_major_strides(arg_shape);
+                std::ptrdiff_t start = 0;
+                for (size_t axis : reversed_axes)
                 {
-                    Coordinate arg_coord = out_coord;
-
-                    for (size_t i = 0; i < arg_coord.size(); i++)
+                    if (arg_shape[axis] > 0)
                     {
-                        if (reversed_axes.count(i) != 0)
-                        {
-                            arg_coord[i] = arg_shape[i] - arg_coord[i] - 1;
-                        }
+                        start +=
+                            arg_strides[axis] * static_cast<std::ptrdiff_t>(arg_shape[axis] - 1);
                     }
-
-                    out[output_transform.index(out_coord)] = arg[arg_transform.index(arg_coord)];
+                    arg_strides[axis] = -arg_strides[axis];
                 }
+
+                strided_copy(arg, out, StridedOffsetIterator(out_shape, arg_strides, start));
             }
         }
     }
@@ -0,0 +1,200 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace roi_sampling
+            {
+                /// \brief Bilinear neighbours of one sampling coordinate along an axis.
+                struct SamplePosition
+                {
+                    size_t low;
+                    size_t high;
+                    float low_weight;
+                    float high_weight;
+                    bool valid;
+                };
+
+                // Sample j of bin b lies at start + b * bin_size + (j + 0.5) * bin_size / grid
+                inline std::vector<SamplePosition> make_sample_positions(
+                    float start, float bin_size, size_t bins, size_t grid, size_t size)
+                {
+                    std::vector<SamplePosition> positions(bins * grid);
+                    for (size_t b = 0; b < bins; b++)
+                    {
+                        for (size_t j = 0; j < grid; j++)
+                        {
+                            SamplePosition& p = positions[b * grid + j];
+                            float x = start + b * bin_size + (j + 0.5f) * bin_size / grid;
+                            if (x < -1.0f || x > size)
+                            {
+                                p = {0, 0, 0.0f, 0.0f, false};
+                                continue;
+                            }
+                            x = std::max(x, 0.0f);
+                            p.low = static_cast<size_t>(x);
+                            if (p.low >= size - 1)
+                            {
+                                p.low = size - 1;
+                                p.high = size - 1;
+                                x = static_cast<float>(p.low);
+                            }
+                            else
+                            {
+                                p.high = p.low + 1;
+                            }
+                            p.high_weight = x - p.low;
+                            p.low_weight = 1.0f - p.high_weight;
+                            p.valid = true;
+                        }
+                    }
+                    return positions;
+                }
+            }
+
+            /// \brief ROIAlign over data [N, C, H, W] with ROIs given as [x1, y1, x2, y2],
+            ///        writing [num_rois, C, pooled_h, pooled_w].
+            ///
+            /// ROIs are processed in parallel. The bilinear sample positions of a ROI are
+            /// separable, so they are computed once per row and column and shared by all
+            /// channels.
+            ///
+            /// \param sampling_ratio Samples per bin along each axis, 0 to derive it from the
+            ///        bin size
+            /// \param max_mode Take the largest sample of a bin rather than the mean
+            /// \param parallel Runs the parallel loops, runtime::parallel_for by default
+            template <typename T, typename I>
+            void roi_align(const T* data,
+                           const T* rois,
+                           const I* batch_indices,
+                           T* out,
+                           const Shape& data_shape,
+                           const Shape& out_shape,
+                           int sampling_ratio,
+                           float spatial_scale,
+                           bool max_mode,
+                           const ParallelFor& parallel = parallel_for)
+            {
+                size_t batches = data_shape[0];
+                size_t channels = data_shape[1];
+                size_t height = data_shape[2];
+                size_t width = data_shape[3];
+                size_t num_rois = out_shape[0];
+                size_t pooled_h = out_shape[2];
+                size_t pooled_w = out_shape[3];
+
+                for (size_t r = 0; r < num_rois; r++)
+                {
+                    NGRAPH_CHECK(batch_indices[r] >= 0 &&
+                                     static_cast<size_t>(batch_indices[r]) < batches,
+                                 "ROIAlign batch index ",
+                                 static_cast<int64_t>(batch_indices[r]),
+                                 " is out of range [0, ",
+                                 batches,
+                                 ")");
+                }
+
+                parallel(num_rois, 1, [&](size_t begin, size_t end) {
+                    for (size_t r = begin; r < end; r++)
+                    {
+                        const T* roi = rois + 4 * r;
+                        float start_w = static_cast<float>(roi[0]) * spatial_scale;
+                        float start_h = static_cast<float>(roi[1]) * spatial_scale;
+                        float roi_w =
+                            std::max(static_cast<float>(roi[2]) * spatial_scale - start_w, 1.0f);
+                        float roi_h =
+                            std::max(static_cast<float>(roi[3]) * spatial_scale - start_h, 1.0f);
+                        float bin_w = roi_w / pooled_w;
+                        float bin_h = roi_h / pooled_h;
+                        size_t grid_w = sampling_ratio > 0
+                                            ? static_cast<size_t>(sampling_ratio)
+                                            : static_cast<size_t>(std::ceil(roi_w / pooled_w));
+                        size_t grid_h = sampling_ratio > 0
+                                            ? static_cast<size_t>(sampling_ratio)
+                                            : static_cast<size_t>(std::ceil(roi_h / pooled_h));
+                        auto xs = roi_sampling::make_sample_positions(
+                            start_w, bin_w, pooled_w, grid_w, width);
+                        auto ys = roi_sampling::make_sample_positions(
+                            start_h, bin_h, pooled_h, grid_h, height);
+                        float count = static_cast<float>(grid_h * grid_w);
+
+                        size_t batch = static_cast<size_t>(batch_indices[r]);
+                        for (size_t c = 0; c < channels; c++)
+                        {
+                            const T* plane = data + (batch * channels + c) * height * width;
+                            T* out_plane = out + (r * channels + c) * pooled_h * pooled_w;
+                            for (size_t ph = 0; ph < pooled_h; ph++)
+                            {
+                                for (size_t pw = 0; pw < pooled_w; pw++)
+                                {
+                                    float pooled = 0.0f;
+                                    bool first = true;
+                                    for (size_t iy = 0; iy < grid_h; iy++)
+                                    {
+                                        const auto& y = ys[ph * grid_h + iy];
+                                        const T* row_low = plane + y.low * width;
+                                        const T* row_high = plane + y.high * width;
+                                        for (size_t ix = 0; ix < grid_w; ix++)
+                                        {
+                                            const auto& x = xs[pw * grid_w + ix];
+                                            float sample = 0.0f;
+                                            if (y.valid && x.valid)
+                                            {
+                                                float top = x.low_weight * row_low[x.low] +
+                                                            x.high_weight * row_low[x.high];
+                                                float bottom = x.low_weight * row_high[x.low] +
+                                                               x.high_weight * row_high[x.high];
+                                                sample =
+                                                    y.low_weight * top + y.high_weight * bottom;
+                                            }
+                                            if (!max_mode)
+                                            {
+                                                pooled += sample;
+                                            }
+                                            else if (first || sample > pooled)
+                                            {
+                                                pooled = sample;
+                                            }
+                                            first = false;
+                                        }
+                                    }
+                                    out_plane[ph * pooled_w + pw] =
+                                        static_cast<T>(max_mode ? pooled : pooled / count);
+                                }
+                            }
+                        }
+                    }
+                });
+            }
+        }
+    }
+}
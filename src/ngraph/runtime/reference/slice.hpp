@@ -20,6 +20,9 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/copy.hpp"
+#include "ngraph/strided_offset_iterator.hpp"
+#include "ngraph/util.hpp"
 
 namespace ngraph
 {
@@ -36,22 +39,22 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                std::vector<std::ptrdiff_t> arg_strides =
+                    StridedOffsetIterator::row_major_strides(arg_shape);
+                Shape slice_shape(arg_shape.size());
+                std::vector<std::ptrdiff_t> slice_strides(arg_shape.size());
+                std::ptrdiff_t start = 0;
+                for (size_t axis = 0; axis < arg_shape.size(); axis++)
                 {
-                    const Coordinate& out_coord = *output_it;
+                    slice_shape[axis] = ceil_div(upper_bounds[axis] - lower_bounds[axis],
+                                                 strides[axis]);
+                    slice_strides[axis] = arg_strides[axis] * strides[axis];
+                    start += arg_strides[axis] * lower_bounds[axis];
+                }
 
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
+                NGRAPH_CHECK(shape_size(slice_shape) == shape_size(out_shape));
 
-                    ++output_it;
-                }
+                strided_copy(arg, out, StridedOffsetIterator(slice_shape, slice_strides, start));
             }
         }
     }
@@ -0,0 +1,159 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <future>
+
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/env_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::ThreadPool::ThreadPool(size_t thread_count)
+{
+    NGRAPH_CHECK(thread_count > 0, "ThreadPool requires at least one thread");
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        m_threads.emplace_back(&ThreadPool::worker, this);
+    }
+}
+
+runtime::ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_cv.notify_all();
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void runtime::ThreadPool::submit(function<void()> task)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_tasks.push_back(move(task));
+    }
+    m_cv.notify_one();
+}
+
+void runtime::ThreadPool::worker()
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+            if (m_tasks.empty())
+            {
+                return;
+            }
+            task = move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+runtime::ThreadPool& runtime::ThreadPool::get_async_pool()
+{
+    static ThreadPool s_async_pool([]() {
+        int32_t thread_count = getenv_int("NGRAPH_ASYNC_THREAD_COUNT");
+        if (thread_count <= 0)
+        {
+            thread_count = std::max(1u, std::thread::hardware_concurrency());
+        }
+        return static_cast<size_t>(thread_count);
+    }());
+    return s_async_pool;
+}
+
+// Set on kernel pool workers and on callers while they run their own range, so nested
+// parallel_for calls run inline instead of waiting on a pool they are occupying.
+static thread_local bool s_in_parallel_for = false;
+
+size_t runtime::get_kernel_thread_count()
+{
+    static size_t s_thread_count = []() {
+        int32_t thread_count = getenv_int("NGRAPH_KERNEL_THREAD_COUNT");
+        if (thread_count <= 0)
+        {
+            thread_count = std::max(1u, std::thread::hardware_concurrency());
+        }
+        return static_cast<size_t>(thread_count);
+    }();
+    return s_thread_count;
+}
+
+void runtime::parallel_for(size_t count,
+                           size_t grain,
+                           const function<void(size_t, size_t)>& body)
+{
+    size_t range_count = std::min(get_kernel_thread_count(), count / std::max<size_t>(grain, 1));
+    if (range_count <= 1 || s_in_parallel_for)
+    {
+        if (count > 0)
+        {
+            body(0, count);
+        }
+        return;
+    }
+
+    static ThreadPool s_kernel_pool(get_kernel_thread_count() - 1);
+    size_t range_size = (count + range_count - 1) / range_count;
+    vector<future<void>> futures;
+    for (size_t begin = range_size; begin < count; begin += range_size)
+    {
+        size_t end = std::min(begin + range_size, count);
+        auto task = make_shared<packaged_task<void()>>([&body, begin, end]() {
+            s_in_parallel_for = true;
+            body(begin, end);
+        });
+        futures.push_back(task->get_future());
+        s_kernel_pool.submit([task]() { (*task)(); });
+    }
+
+    exception_ptr caller_exception;
+    s_in_parallel_for = true;
+    try
+    {
+        body(0, std::min(range_size, count));
+    }
+    catch (...)
+    {
+        caller_exception = current_exception();
+    }
+    s_in_parallel_for = false;
+    // Every range must finish before body goes out of scope, even if one of them threw
+    for (auto& f : futures)
+    {
+        f.wait();
+    }
+    if (caller_exception)
+    {
+        rethrow_exception(caller_exception);
+    }
+    for (auto& f : futures)
+    {
+        f.get();
+    }
+}
@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Fixed-size pool of worker threads executing submitted tasks in FIFO order.
+        class NGRAPH_API ThreadPool
+        {
+        public:
+            /// \param thread_count Number of worker threads, must be nonzero
+            ThreadPool(size_t thread_count);
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+            /// \brief Runs all tasks already submitted and joins the worker threads.
+            ~ThreadPool();
+
+            void submit(std::function<void()> task);
+            size_t get_thread_count() const { return m_threads.size(); }
+            /// \brief The process-wide pool used by Executable::async_call. Sized by
+            ///        NGRAPH_ASYNC_THREAD_COUNT, defaulting to the hardware concurrency.
+            static ThreadPool& get_async_pool();
+
+        private:
+            void worker();
+
+            std::vector<std::thread> m_threads;
+            std::deque<std::function<void()>> m_tasks;
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            bool m_stopping = false;
+        };
+
+        /// \brief Number of threads, including the caller, that parallel_for spreads work
+        ///        over. Set by NGRAPH_KERNEL_THREAD_COUNT, defaulting to the hardware
+        ///        concurrency.
+        NGRAPH_API size_t get_kernel_thread_count();
+
+        /// \brief Splits [0, count) into contiguous ranges of at least grain items and runs
+        ///        body(begin, end) on each, one range on the calling thread and the rest on a
+        ///        process-wide kernel pool. Runs inline when there is only one range or when
+        ///        called from inside another parallel_for body.
+        NGRAPH_API void parallel_for(size_t count,
+                                     size_t grain,
+                                     const std::function<void(size_t, size_t)>& body);
+
+        /// \brief A parallel_for. Kernels that take one can be run on a backend's own pools.
+        using ParallelFor = std::function<void(
+            size_t count, size_t grain, const std::function<void(size_t, size_t)>& body)>;
+    }
+}
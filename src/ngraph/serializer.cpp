@@ -14,9 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <queue>
+#include <sstream>
 #include <stack>
 
 #include "ngraph/attribute_visitor.hpp"
@@ -28,6 +30,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/provenance.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -36,6 +39,8 @@ using namespace ngraph;
 using namespace std;
 using json = nlohmann::json;
 using const_data_callback_t = shared_ptr<Node>(const string&, const element::Type&, const Shape&);
+using constant_data_reader_t =
+    shared_ptr<Node>(const element::Type&, const Shape&, uint64_t offset, uint64_t size);
 
 static json write_element_type(const ngraph::element::Type& n);
 static element::Type read_element_type(json j);
@@ -159,6 +164,90 @@ protected:
     json& m_json;
 };
 
+// Layout of a binary model:
+//   BinaryModelHeader
+//   the functions as a CBOR encoded json array, as in the json format but with each constant
+//       referring to its payload by offset instead of listing its values
+//   padding to a page boundary
+//   the constant data section, each payload aligned to s_constant_data_alignment
+// Fields are stored in host byte order.
+static const char s_binary_model_magic[8] = {'N', 'G', 'R', 'A', 'P', 'H', 'B', '\0'};
+static const uint32_t s_binary_model_version = 1;
+static const size_t s_constant_data_alignment = 64;
+static const size_t s_constant_section_alignment = 4096;
+
+struct BinaryModelHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t metadata_offset;
+    uint64_t metadata_size;
+    uint64_t data_offset;
+    uint64_t data_size;
+};
+
+// Payloads of the constants of a binary model in the order they are added. Constants that share
+// their data, such as copies of one constant, are stored once.
+class ConstantDataSection
+{
+public:
+    uint64_t add(const op::Constant& constant)
+    {
+        const void* data = constant.get_data_ptr();
+        size_t size = shape_size(constant.get_shape()) * constant.get_element_type().size();
+        auto it = m_offsets.find(data);
+        if (it != m_offsets.end() && m_payloads[it->second].size >= size)
+        {
+            return m_payloads[it->second].offset;
+        }
+        uint64_t offset = align(m_size);
+        m_offsets[data] = m_payloads.size();
+        m_payloads.push_back({data, size, offset});
+        m_size = offset + size;
+        return offset;
+    }
+
+    uint64_t get_size() const { return m_size; }
+    void write(ostream& out) const
+    {
+        uint64_t position = 0;
+        for (const Payload& payload : m_payloads)
+        {
+            write_padding(out, payload.offset - position);
+            out.write(static_cast<const char*>(payload.data), payload.size);
+            position = payload.offset + payload.size;
+        }
+    }
+
+    static uint64_t align(uint64_t offset, uint64_t alignment = s_constant_data_alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    static void write_padding(ostream& out, uint64_t size)
+    {
+        static const char zeros[s_constant_data_alignment] = {};
+        while (size > 0)
+        {
+            uint64_t chunk = std::min<uint64_t>(size, sizeof(zeros));
+            out.write(zeros, chunk);
+            size -= chunk;
+        }
+    }
+
+private:
+    struct Payload
+    {
+        const void* data;
+        size_t size;
+        uint64_t offset;
+    };
+    vector<Payload> m_payloads;
+    unordered_map<const void*, size_t> m_offsets;
+    uint64_t m_size{0};
+};
+
 class JSONSerializer
 {
 public:
@@ -173,6 +262,9 @@ public:
         m_binary_constant_data = binary_constant_data;
     }
 
+    /// Constants are written to section instead of listing their values
+    void set_constant_data_section(ConstantDataSection* section) { m_constant_data = section; }
+
     json serialize_function(const Function& function);
     json serialize_output(const Output<Node>& output);
     json serialize_parameter_vector(const ParameterVector& parameters);
@@ -188,6 +280,7 @@ protected:
     size_t m_indent{0};
     bool m_serialize_output_shapes{false};
     bool m_binary_constant_data{false};
+    ConstantDataSection* m_constant_data{nullptr};
     json m_json_nodes;
 };
 
@@ -284,7 +377,15 @@ public:
         m_const_data_callback = const_data_callback;
     }
 
+    /// Creates the constants of a binary model from their data section
+    void set_constant_data_reader(function<constant_data_reader_t> constant_data_reader)
+    {
+        m_constant_data_reader = constant_data_reader;
+    }
+
     shared_ptr<Function> deserialize_function(json j);
+    /// Creates a function from its name, parameters and results once its ops are deserialized
+    shared_ptr<Function> make_function(const json& func_js);
     Output<Node> deserialize_output(json j);
     OutputVector deserialize_output_vector(json j);
     ParameterVector deserialize_parameter_vector(json j);
@@ -300,6 +401,74 @@ protected:
     unordered_map<string, shared_ptr<Node>> m_node_map;
     unordered_map<string, shared_ptr<Function>> m_function_map;
     function<const_data_callback_t> m_const_data_callback;
+    function<constant_data_reader_t> m_constant_data_reader;
+    // Payload of the next Constant, already decoded by JSONStreamingDeserializer
+    shared_ptr<runtime::AlignedBuffer> m_streamed_constant_data;
+};
+
+// Deserializes a json model as it is parsed instead of from a parsed document. Only the op
+// being read is held as json; it is deserialized as soon as its object ends. The values of a
+// Constant are decoded one by one into the buffer the Constant will own, rather than being
+// held as a list of strings first. Peak memory therefore stays close to the size of the model.
+//
+// Implements the SAX interface of nlohmann::json. The model is a list of functions, each an
+// object whose "ops" list is streamed; its other members are small and are kept as json.
+class JSONStreamingDeserializer : public JSONDeserializer
+{
+public:
+    bool null() { return add_value(nullptr); }
+    bool boolean(bool val) { return add_value(val); }
+    bool number_integer(json::number_integer_t val) { return add_value(val); }
+    bool number_unsigned(json::number_unsigned_t val) { return add_value(val); }
+    bool number_float(json::number_float_t val, const std::string& /* s */)
+    {
+        return add_value(val);
+    }
+    bool string(std::string& val);
+    template <typename Binary>
+    bool binary(Binary& /* val */)
+    {
+        throw ngraph_error("Unexpected binary value in json model");
+    }
+    bool start_object(size_t /* elements */);
+    bool key(std::string& val);
+    bool end_object();
+    bool start_array(size_t /* elements */);
+    bool end_array();
+    template <typename Exception>
+    bool parse_error(size_t /* position */,
+                     const std::string& /* last_token */,
+                     const Exception& ex)
+    {
+        throw ngraph_error(std::string("Error parsing json model: ") + ex.what());
+    }
+
+    shared_ptr<Function> get_function() const { return m_function; }
+
+private:
+    bool add_value(json&& val);
+    json* add_container(json&& val);
+    void add_constant_literal(const std::string& literal);
+    void end_constant_value();
+
+    size_t m_depth{0};
+    // The function or op being read, and the json containers open within it
+    json m_function_js;
+    json m_node_js;
+    vector<json*> m_open;
+    std::string m_key;
+    // Set while the value of a key that is streamed is expected
+    bool m_ops_key{false};
+    bool m_value_key{false};
+    bool m_in_ops{false};
+    // The values of the Constant being read
+    bool m_in_constant_value{false};
+    element::Type m_constant_type;
+    size_t m_constant_size{0};
+    size_t m_constant_count{0};
+    std::string m_first_literal;
+    shared_ptr<runtime::AlignedBuffer> m_constant_data;
+    shared_ptr<Function> m_function;
 };
 
 static string
@@ -500,10 +669,382 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+void ngraph::serialize_binary(const string& path, shared_ptr<Function> func)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    NGRAPH_CHECK(out, "Unable to open '", path, "' for writing");
+    serialize_binary(out, func);
+}
+
+void ngraph::serialize_binary(ostream& out, shared_ptr<Function> func)
+{
+    ConstantDataSection constant_data;
+    JSONSerializer serializer;
+    serializer.set_serialize_output_shapes(s_serialize_output_shapes_enabled);
+    serializer.set_constant_data_section(&constant_data);
+    json j;
+    j.push_back(serializer.serialize_function(*func));
+    vector<uint8_t> metadata = json::to_cbor(j);
+
+    BinaryModelHeader header{};
+    memcpy(header.magic, s_binary_model_magic, sizeof(header.magic));
+    header.version = s_binary_model_version;
+    header.metadata_offset = sizeof(header);
+    header.metadata_size = metadata.size();
+    header.data_offset = ConstantDataSection::align(header.metadata_offset + metadata.size(),
+                                                    s_constant_section_alignment);
+    header.data_size = constant_data.get_size();
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(metadata.data()), metadata.size());
+    ConstantDataSection::write_padding(
+        out, header.data_offset - header.metadata_offset - header.metadata_size);
+    constant_data.write(out);
+}
+
+static bool is_binary_model(istream& in)
+{
+    auto position = in.tellg();
+    char magic[sizeof(s_binary_model_magic)] = {};
+    in.read(magic, sizeof(magic));
+    bool rc =
+        in.gcount() == sizeof(magic) && memcmp(magic, s_binary_model_magic, sizeof(magic)) == 0;
+    in.clear();
+    in.seekg(position);
+    return rc;
+}
+
+bool ngraph::is_binary_model(const string& path)
+{
+    ifstream in(path, ios_base::binary | ios_base::in);
+    return in && ::is_binary_model(in);
+}
+
+// Deserializes a binary model held in data. Constants whose payload is suitably aligned use
+// it in place and keep owner alive; the others get a copy.
+static shared_ptr<Function>
+    deserialize_binary(char* data, size_t size, const shared_ptr<void>& owner)
+{
+    BinaryModelHeader header;
+    NGRAPH_CHECK(size >= sizeof(header), "Binary model is truncated");
+    memcpy(&header, data, sizeof(header));
+    NGRAPH_CHECK(memcmp(header.magic, s_binary_model_magic, sizeof(header.magic)) == 0,
+                 "Not a binary model");
+    NGRAPH_CHECK(header.version == s_binary_model_version,
+                 "Unsupported binary model version ",
+                 header.version);
+    NGRAPH_CHECK(header.metadata_offset + header.metadata_size <= size &&
+                     header.data_offset + header.data_size <= size,
+                 "Binary model is truncated");
+
+    const uint8_t* metadata = reinterpret_cast<const uint8_t*>(data + header.metadata_offset);
+    json js = json::from_cbor(vector<uint8_t>(metadata, metadata + header.metadata_size));
+
+    char* constant_data = data + header.data_offset;
+    JSONDeserializer deserializer;
+    deserializer.set_constant_data_reader([&](const element::Type& et,
+                                              const Shape& shape,
+                                              uint64_t offset,
+                                              uint64_t data_size) -> shared_ptr<Node> {
+        NGRAPH_CHECK(offset + data_size <= header.data_size &&
+                         data_size == shape_size(shape) * et.size(),
+                     "Constant data out of range in binary model");
+        char* payload = constant_data + offset;
+        if (reinterpret_cast<uintptr_t>(payload) % s_constant_data_alignment == 0)
+        {
+            return make_shared<op::Constant>(
+                et,
+                shape,
+                make_shared<runtime::SharedBuffer<shared_ptr<void>>>(payload, data_size, owner));
+        }
+        return make_shared<op::Constant>(et, shape, payload);
+    });
+    shared_ptr<Function> rc;
+    for (json func : js)
+    {
+        rc = deserializer.deserialize_function(func);
+    }
+    return rc;
+}
+
+std::string ngraph::serialize_node_attributes(const Node& node)
+{
+    JSONSerializer serializer;
+    json node_js = serializer.serialize_node(node);
+    // Keep only what describes the op itself, not its name or neighbours
+    for (const char* key : {"name",
+                            "friendly_name",
+                            "inputs",
+                            "control_deps",
+                            "outputs",
+                            "output_shapes",
+                            "provenance_tags"})
+    {
+        node_js.erase(key);
+    }
+    return node_js.dump();
+}
+
+// Decodes a literal of a Constant as op::Constant does from a list of strings
+static void write_constant_literal(const element::Type& et,
+                                   void* target,
+                                   size_t index,
+                                   const string& literal)
+{
+    switch (et)
+    {
+    case element::Type_t::boolean:
+        static_cast<char*>(target)[index] = parse_string<uint8_t>(literal);
+        break;
+    case element::Type_t::bf16:
+        static_cast<bfloat16*>(target)[index] = parse_string<float>(literal);
+        break;
+    case element::Type_t::f16:
+        static_cast<float16*>(target)[index] = parse_string<float>(literal);
+        break;
+    case element::Type_t::f32:
+        static_cast<float*>(target)[index] = parse_string<float>(literal);
+        break;
+    case element::Type_t::f64:
+        static_cast<double*>(target)[index] = parse_string<double>(literal);
+        break;
+    case element::Type_t::i8:
+        static_cast<int8_t*>(target)[index] = parse_string<int8_t>(literal);
+        break;
+    case element::Type_t::i16:
+        static_cast<int16_t*>(target)[index] = parse_string<int16_t>(literal);
+        break;
+    case element::Type_t::i32:
+        static_cast<int32_t*>(target)[index] = parse_string<int32_t>(literal);
+        break;
+    case element::Type_t::i64:
+        static_cast<int64_t*>(target)[index] = parse_string<int64_t>(literal);
+        break;
+    case element::Type_t::u8:
+        static_cast<uint8_t*>(target)[index] = parse_string<uint8_t>(literal);
+        break;
+    case element::Type_t::u16:
+        static_cast<uint16_t*>(target)[index] = parse_string<uint16_t>(literal);
+        break;
+    case element::Type_t::u32:
+        static_cast<uint32_t*>(target)[index] = parse_string<uint32_t>(literal);
+        break;
+    case element::Type_t::u64:
+        static_cast<uint64_t*>(target)[index] = parse_string<uint64_t>(literal);
+        break;
+    case element::Type_t::u1:
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+        throw ngraph_error("deserialize unsupported type " + et.get_type_name());
+    }
+}
+
+bool JSONStreamingDeserializer::add_value(json&& val)
+{
+    m_ops_key = false;
+    m_value_key = false;
+    NGRAPH_CHECK(!m_open.empty(), "Unexpected value in json model");
+    add_container(move(val));
+    return true;
+}
+
+json* JSONStreamingDeserializer::add_container(json&& val)
+{
+    json& parent = *m_open.back();
+    if (parent.is_object())
+    {
+        json& member = parent[m_key];
+        member = move(val);
+        return &member;
+    }
+    parent.push_back(move(val));
+    return &parent.back();
+}
+
+bool JSONStreamingDeserializer::string(std::string& val)
+{
+    if (m_in_constant_value)
+    {
+        add_constant_literal(val);
+        return true;
+    }
+    return add_value(move(val));
+}
+
+bool JSONStreamingDeserializer::start_object(size_t /* elements */)
+{
+    m_ops_key = false;
+    m_value_key = false;
+    ++m_depth;
+    if (m_depth == 2)
+    {
+        // A function
+        m_function_js = json::object();
+        m_open.assign(1, &m_function_js);
+    }
+    else if (m_in_ops && m_depth == 4)
+    {
+        // An op of the function
+        m_node_js = json::object();
+        m_open.assign(1, &m_node_js);
+    }
+    else
+    {
+        NGRAPH_CHECK(!m_open.empty(), "Unexpected object in json model");
+        m_open.push_back(add_container(json::object()));
+    }
+    return true;
+}
+
+bool JSONStreamingDeserializer::key(std::string& val)
+{
+    // The ops of a function, and the values of a Constant whose type and shape are already
+    // known, are not kept as json
+    m_ops_key = (m_depth == 2 && val == "ops");
+    m_value_key = (m_in_ops && m_depth == 4 && val == "value" &&
+                   m_node_js.value("op", std::string()) == "Constant" &&
+                   m_node_js.count("element_type") != 0 && m_node_js.count("shape") != 0);
+    m_key = move(val);
+    return true;
+}
+
+bool JSONStreamingDeserializer::end_object()
+{
+    if (m_depth == 2)
+    {
+        m_function = make_function(m_function_js);
+        m_function_js = json();
+        m_open.clear();
+    }
+    else if (m_in_ops && m_depth == 4)
+    {
+        deserialize_node(m_node_js);
+        m_streamed_constant_data.reset();
+        m_node_js = json();
+        m_open.clear();
+    }
+    else
+    {
+        m_open.pop_back();
+    }
+    --m_depth;
+    return true;
+}
+
+bool JSONStreamingDeserializer::start_array(size_t /* elements */)
+{
+    ++m_depth;
+    if (m_depth == 1)
+    {
+        // The list of functions
+    }
+    else if (m_ops_key)
+    {
+        m_in_ops = true;
+        m_open.clear();
+    }
+    else if (m_value_key)
+    {
+        m_in_constant_value = true;
+        m_constant_type = read_element_type(m_node_js.at("element_type"));
+        m_constant_size = shape_size(m_node_js.at("shape").get<vector<size_t>>());
+        m_constant_count = 0;
+    }
+    else
+    {
+        NGRAPH_CHECK(!m_open.empty(), "Unexpected array in json model");
+        m_open.push_back(add_container(json::array()));
+    }
+    m_ops_key = false;
+    m_value_key = false;
+    return true;
+}
+
+bool JSONStreamingDeserializer::end_array()
+{
+    if (m_in_constant_value)
+    {
+        end_constant_value();
+    }
+    else if (m_in_ops && m_depth == 3)
+    {
+        m_in_ops = false;
+        m_open.assign(1, &m_function_js);
+    }
+    else if (m_depth > 1)
+    {
+        m_open.pop_back();
+    }
+    --m_depth;
+    return true;
+}
+
+void JSONStreamingDeserializer::add_constant_literal(const std::string& literal)
+{
+    NGRAPH_CHECK(m_constant_count < m_constant_size,
+                 "Did not get the expected number of literals for constant ",
+                 m_node_js.value("name", std::string()),
+                 " (expected ",
+                 m_constant_size,
+                 ")");
+    if (m_constant_count == 0)
+    {
+        // A single literal is broadcast, which op::Constant does from the string
+        m_first_literal = literal;
+    }
+    else
+    {
+        if (m_constant_count == 1)
+        {
+            m_constant_data = make_shared<runtime::AlignedBuffer>(
+                m_constant_size * m_constant_type.size(), s_constant_data_alignment);
+            write_constant_literal(m_constant_type, m_constant_data->get_ptr(), 0, m_first_literal);
+        }
+        write_constant_literal(
+            m_constant_type, m_constant_data->get_ptr(), m_constant_count, literal);
+    }
+    ++m_constant_count;
+}
+
+void JSONStreamingDeserializer::end_constant_value()
+{
+    m_in_constant_value = false;
+    json& value = m_node_js[m_key];
+    value = json::array();
+    if (m_constant_count <= 1)
+    {
+        if (m_constant_count == 1)
+        {
+            value.push_back(move(m_first_literal));
+        }
+        return;
+    }
+    NGRAPH_CHECK(m_constant_count == m_constant_size,
+                 "Did not get the expected number of literals for constant ",
+                 m_node_js.value("name", std::string()),
+                 " (got ",
+                 m_constant_count,
+                 ", expected ",
+                 m_constant_size,
+                 ")");
+    m_streamed_constant_data = move(m_constant_data);
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    if (::is_binary_model(in))
+    {
+        // Not a file that can be mapped, so read it into memory the constants can share
+        stringstream ss;
+        ss << in.rdbuf();
+        string contents = ss.str();
+        auto buffer =
+            make_shared<runtime::AlignedBuffer>(contents.size(), s_constant_data_alignment);
+        memcpy(buffer->get_ptr(), contents.data(), contents.size());
+        rc = deserialize_binary(buffer->get_ptr<char>(), contents.size(), buffer);
+    }
+    else if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
         vector<cpio::FileInfo> file_info = reader.get_file_info();
@@ -541,10 +1082,10 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
     }
     else
     {
-        // json file?
-        std::stringstream ss;
-        ss << in.rdbuf();
-        rc = deserialize(ss.str());
+        // json, deserialized while it is read rather than parsed into a document first
+        JSONStreamingDeserializer deserializer;
+        json::sax_parse(in, &deserializer);
+        rc = deserializer.get_function();
     }
     return rc;
 }
@@ -554,18 +1095,21 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     shared_ptr<Function> rc;
     if (file_util::exists(s))
     {
+        if (is_binary_model(s))
+        {
+            // Map the file so the constants use its pages instead of copies
+            auto file = make_shared<file_util::MappedFile>(s);
+            return deserialize_binary(file->get_data(), file->get_size(), file);
+        }
         // s is a file and not a json string
         ifstream in(s, ios_base::binary | ios_base::in);
         rc = deserialize(in);
     }
     else
     {
-        json js = json::parse(s);
-        JSONDeserializer deserializer;
-        for (json func : js)
-        {
-            rc = deserializer.deserialize_function(func);
-        }
+        JSONStreamingDeserializer deserializer;
+        json::sax_parse(s, &deserializer);
+        rc = deserializer.get_function();
     }
     return rc;
 }
@@ -819,12 +1363,17 @@ ParameterVector JSONDeserializer::deserialize_parameter_vector(json json_paramet
 
 shared_ptr<Function> JSONDeserializer::deserialize_function(json func_js)
 {
-    string func_name = func_js.at("name").get<string>();
-    vector<json> func_result = func_js.at("result");
     for (json node_js : func_js.at("ops"))
     {
         deserialize_node(node_js);
     }
+    return make_function(func_js);
+}
+
+shared_ptr<Function> JSONDeserializer::make_function(const json& func_js)
+{
+    string func_name = func_js.at("name").get<string>();
+    vector<json> func_result = func_js.at("result");
 
     // This handles both graphs w/ `op::Result` and legacy graphs w/o it
     // If we are dealing w/ a legacy graph, add op::Result for each output node
@@ -1144,6 +1693,25 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
+            if (has_key(node_js, "data_offset"))
+            {
+                NGRAPH_CHECK(m_constant_data_reader,
+                             "Constant ",
+                             node_name,
+                             " refers to the data section of a binary model");
+                node = m_constant_data_reader(element_type,
+                                              shape.get<vector<size_t>>(),
+                                              node_js.at("data_offset").get<uint64_t>(),
+                                              node_js.at("data_size").get<uint64_t>());
+                break;
+            }
+            if (m_streamed_constant_data)
+            {
+                node = make_shared<op::Constant>(
+                    element_type, shape.get<vector<size_t>>(), m_streamed_constant_data);
+                m_streamed_constant_data.reset();
+                break;
+            }
             auto value = node_js.at("value").get<vector<string>>();
             node = make_shared<op::Constant>(element_type, shape, value);
             break;
@@ -2876,7 +3444,13 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant:
     {
         auto tmp = static_cast<const op::Constant*>(&n);
-        if (tmp->get_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
+        if (m_constant_data)
+        {
+            node["data_offset"] = m_constant_data->add(*tmp);
+            node["data_size"] = shape_size(tmp->get_shape()) * tmp->get_element_type().size();
+        }
+        else if (tmp->get_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_shape()) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
@@ -51,6 +51,33 @@ namespace ngraph
     NGRAPH_API
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to the binary model format
+    ///
+    /// The graph is stored as a compact CBOR table, followed by a page aligned section with
+    /// the data of every constant, each payload aligned for direct use. deserialize recognizes
+    /// the format. Given the path of a binary model it memory maps the file, and the constants
+    /// read their data from the mapped pages instead of holding copies.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serialize a Function to a stream in the binary model format
+    /// \param out The output stream, which should be opened in binary mode
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Returns true if the file at path is in the binary model format
+    NGRAPH_API
+    bool is_binary_model(const std::string& path);
+
+    /// \brief Serialize the type and attributes of a node to a json string, leaving out its
+    ///        name, its inputs and outputs and anything else that identifies it in a graph
+    /// \param node The node to serialize
+    NGRAPH_API
+    std::string serialize_node_attributes(const Node& node);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     NGRAPH_API
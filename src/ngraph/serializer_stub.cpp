@@ -33,6 +33,26 @@ void ngraph::serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func
     throw std::runtime_error("serializer disabled in build");
 }
 
+void ngraph::serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+bool ngraph::is_binary_model(const std::string& path)
+{
+    return false;
+}
+
+std::string ngraph::serialize_node_attributes(const Node& node)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
 std::shared_ptr<ngraph::Function> ngraph::deserialize(std::istream& in)
 {
     throw std::runtime_error("serializer disabled in build");
@@ -0,0 +1,159 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    /// \brief Walks the row-major coordinates of a shape and tracks, for each one, the linear
+    ///        offset of the corresponding element in a strided source and in a strided target.
+    ///
+    /// Unlike CoordinateTransform::Iterator it never materializes a Coordinate: both offsets
+    /// are advanced odometer-style from precomputed per-axis strides, without allocating, and
+    /// iteration is exposed one innermost run at a time so the loop over a run is a plain
+    /// strided loop. Unit axes are dropped and adjacent axes that are contiguous in both source
+    /// and target are merged, so runs are as long as possible.
+    ///
+    /// \code
+    /// for (StridedOffsetIterator it(shape, strides, start); !it.done(); it.next_run())
+    /// {
+    ///     const T* src = arg + it.source_offset();
+    ///     T* dst = out + it.target_offset();
+    ///     for (size_t i = 0; i < it.run_size(); i++)
+    ///     {
+    ///         dst[i] = src[i * it.source_run_stride()];
+    ///     }
+    /// }
+    /// \endcode
+    class StridedOffsetIterator
+    {
+    public:
+        /// \param shape The iteration space, walked in row-major order
+        /// \param source_strides Source step, in elements, for a unit move along each axis of
+        ///        shape. May be zero (broadcast) or negative (reverse).
+        /// \param source_start Source offset of the first coordinate
+        /// \param target_strides Target step for a unit move along each axis of shape
+        /// \param target_start Target offset of the first coordinate
+        StridedOffsetIterator(const Shape& shape,
+                              const std::vector<std::ptrdiff_t>& source_strides,
+                              std::ptrdiff_t source_start,
+                              const std::vector<std::ptrdiff_t>& target_strides,
+                              std::ptrdiff_t target_start)
+            : m_source_offset(source_start)
+            , m_target_offset(target_start)
+            , m_done(shape_size(shape) == 0)
+        {
+            NGRAPH_CHECK(source_strides.size() == shape.size() &&
+                             target_strides.size() == shape.size(),
+                         "Strides must have one entry per axis");
+            for (size_t axis = 0; axis < shape.size(); axis++)
+            {
+                if (shape[axis] == 1)
+                {
+                    continue;
+                }
+                std::ptrdiff_t extent = static_cast<std::ptrdiff_t>(shape[axis]);
+                if (!m_shape.empty() && m_source_strides.back() == source_strides[axis] * extent &&
+                    m_target_strides.back() == target_strides[axis] * extent)
+                {
+                    m_shape.back() *= shape[axis];
+                    m_source_strides.back() = source_strides[axis];
+                    m_target_strides.back() = target_strides[axis];
+                }
+                else
+                {
+                    m_shape.push_back(shape[axis]);
+                    m_source_strides.push_back(source_strides[axis]);
+                    m_target_strides.push_back(target_strides[axis]);
+                }
+            }
+            if (m_shape.empty())
+            {
+                m_shape.push_back(1);
+                m_source_strides.push_back(0);
+                m_target_strides.push_back(0);
+            }
+            m_counter.assign(m_shape.size(), 0);
+        }
+
+        /// \brief Iterates a strided source into a densely packed, row-major target.
+        StridedOffsetIterator(const Shape& shape,
+                              const std::vector<std::ptrdiff_t>& source_strides,
+                              std::ptrdiff_t source_start = 0)
+            : StridedOffsetIterator(
+                  shape, source_strides, source_start, row_major_strides(shape), 0)
+        {
+        }
+
+        bool done() const { return m_done; }
+        /// \brief Source offset of the first element of the current run
+        std::ptrdiff_t source_offset() const { return m_source_offset; }
+        /// \brief Target offset of the first element of the current run
+        std::ptrdiff_t target_offset() const { return m_target_offset; }
+        /// \brief Number of elements in each run
+        size_t run_size() const { return m_shape.back(); }
+        /// \brief Source step between consecutive elements of a run
+        std::ptrdiff_t source_run_stride() const { return m_source_strides.back(); }
+        /// \brief Target step between consecutive elements of a run
+        std::ptrdiff_t target_run_stride() const { return m_target_strides.back(); }
+        /// \brief Advances to the first element of the next run
+        void next_run()
+        {
+            for (size_t axis = m_shape.size() - 1; axis-- > 0;)
+            {
+                m_source_offset += m_source_strides[axis];
+                m_target_offset += m_target_strides[axis];
+                if (++m_counter[axis] < m_shape[axis])
+                {
+                    return;
+                }
+                std::ptrdiff_t extent = static_cast<std::ptrdiff_t>(m_shape[axis]);
+                m_source_offset -= m_source_strides[axis] * extent;
+                m_target_offset -= m_target_strides[axis] * extent;
+                m_counter[axis] = 0;
+            }
+            m_done = true;
+        }
+
+        /// \brief Row-major element strides of shape
+        static std::vector<std::ptrdiff_t> row_major_strides(const Shape& shape)
+        {
+            std::vector<std::ptrdiff_t> strides(shape.size());
+            std::ptrdiff_t stride = 1;
+            for (size_t axis = shape.size(); axis-- > 0;)
+            {
+                strides[axis] = stride;
+                stride *= static_cast<std::ptrdiff_t>(shape[axis]);
+            }
+            return strides;
+        }
+
+    private:
+        Shape m_shape;
+        std::vector<std::ptrdiff_t> m_source_strides;
+        std::vector<std::ptrdiff_t> m_target_strides;
+        std::vector<size_t> m_counter;
+        std::ptrdiff_t m_source_offset;
+        std::ptrdiff_t m_target_offset;
+        bool m_done;
+    };
+}
@@ -0,0 +1,327 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+#include <unordered_map>
+
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/structural_hash.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    /// \brief Writes every visited attribute as "name=value;" in a form that does not lose
+    ///        precision, so equal text means equal attributes.
+    class SignatureAttributeVisitor : public AttributeVisitor
+    {
+    public:
+        SignatureAttributeVisitor(ostream& out)
+            : m_out(out)
+        {
+        }
+
+        bool is_complete() const { return m_complete; }
+        void on_attribute(const string& name, string& value) override
+        {
+            // Length prefix so a value cannot run into the next attribute
+            m_out << name << "=" << value.size() << ":" << value << ";";
+        }
+        void on_attribute(const string& name, bool& value) override
+        {
+            m_out << name << "=" << value << ";";
+        }
+        void on_attribute(const string& name, void* data, size_t size) override
+        {
+            m_out << name << "=" << size << "#" << hex << fnv1a_hash(data, size) << dec << ";";
+        }
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            if (auto a = dynamic_cast<AttributeAdapter<PartialShape>*>(&adapter))
+            {
+                m_out << name << "=" << static_cast<PartialShape&>(*a) << ";";
+            }
+            else if (auto a = dynamic_cast<AttributeAdapter<op::AutoBroadcastSpec>*>(&adapter))
+            {
+                const op::AutoBroadcastSpec& value = *a;
+                m_out << name << "=" << static_cast<int>(value.m_type) << "," << value.m_axis
+                      << ";";
+            }
+            else if (auto a = dynamic_cast<AttributeAdapter<op::BroadcastModeSpec>*>(&adapter))
+            {
+                const op::BroadcastModeSpec& value = *a;
+                m_out << name << "=" << static_cast<int>(value.m_type) << "," << value.m_axis
+                      << ";";
+            }
+            else
+            {
+                m_out << name << "=?" << adapter.get_type_info().name << ";";
+                m_complete = false;
+            }
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            string value = adapter.get();
+            on_attribute(name, value);
+        }
+        void on_adapter(const string& name, ValueAccessor<int8_t>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int16_t>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int32_t>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint8_t>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint16_t>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint32_t>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint64_t>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<float>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            write(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            write_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            m_out << name << "=[";
+            for (const string& value : adapter.get())
+            {
+                m_out << value.size() << ":" << value << ",";
+            }
+            m_out << "];";
+        }
+
+    private:
+        template <typename T>
+        void write_value(const T& value)
+        {
+            // Widen so that 8-bit values print as numbers rather than characters
+            typename conditional<is_floating_point<T>::value,
+                                 T,
+                                 typename conditional<is_signed<T>::value, int64_t, uint64_t>::
+                                     type>::type wide = value;
+            m_out << setprecision(numeric_limits<T>::max_digits10) << wide;
+        }
+        template <typename T>
+        void write(const string& name, ValueAccessor<T>& adapter)
+        {
+            m_out << name << "=";
+            write_value(adapter.get());
+            m_out << ";";
+        }
+        template <typename T>
+        void write_vector(const string& name, ValueAccessor<vector<T>>& adapter)
+        {
+            m_out << name << "=[";
+            for (const T& value : adapter.get())
+            {
+                write_value(value);
+                m_out << ",";
+            }
+            m_out << "];";
+        }
+
+        ostream& m_out;
+        bool m_complete{true};
+    };
+}
+
+uint64_t ngraph::fnv1a_hash(const void* data, size_t size, uint64_t seed)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+bool ngraph::get_structural_signature(const Function& function, string& signature)
+{
+    bool complete = true;
+    stringstream out;
+    unordered_map<const Node*, size_t> op_index;
+    for (const shared_ptr<Node>& node : function.get_ordered_ops())
+    {
+        size_t index = op_index.size();
+        op_index[node.get()] = index;
+
+        const NodeTypeInfo& type_info = node->get_type_info();
+        out << index << " " << type_info.name << "." << type_info.version << " in=[";
+        for (const Input<Node>& input : node->inputs())
+        {
+            Output<Node> source = input.get_source_output();
+            out << op_index.at(source.get_node()) << ":" << source.get_index() << ",";
+        }
+        out << "] cdep=[";
+        for (const shared_ptr<Node>& dep : node->get_control_dependencies())
+        {
+            out << op_index.at(dep.get()) << ",";
+        }
+        out << "] out=[";
+        for (const Output<Node>& output : node->outputs())
+        {
+            out << output.get_element_type().get_type_name() << output.get_partial_shape()
+                << ",";
+        }
+        out << "] attr={";
+        SignatureAttributeVisitor visitor(out);
+        if (!node->visit_attributes(visitor))
+        {
+#ifdef NGRAPH_JSON_DISABLE
+            complete = false;
+#else
+            // The op has no attribute visitor yet; the serializer knows its attributes
+            out << serialize_node_attributes(*node);
+#endif
+        }
+        complete = complete && visitor.is_complete();
+        out << "}\n";
+    }
+    out << "parameters=[";
+    for (const shared_ptr<op::Parameter>& parameter : function.get_parameters())
+    {
+        out << op_index.at(parameter.get()) << ",";
+    }
+    out << "] results=[";
+    for (const shared_ptr<op::Result>& result : function.get_results())
+    {
+        out << op_index.at(result.get()) << ",";
+    }
+    out << "]\n";
+    signature = complete ? out.str() : "";
+    return complete;
+}
+
+bool ngraph::get_structural_hash(const Function& function, uint64_t& hash)
+{
+    string signature;
+    bool complete = get_structural_signature(function, signature);
+    hash = fnv1a_hash(signature.data(), signature.size());
+    return complete;
+}
+
+bool ngraph::constant_data_equal(const Function& a, const Function& b)
+{
+    vector<shared_ptr<op::Constant>> b_constants;
+    for (const shared_ptr<Node>& node : b.get_ordered_ops())
+    {
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            b_constants.push_back(constant);
+        }
+    }
+    return constant_data_equal(a, b_constants);
+}
+
+bool ngraph::constant_data_equal(const Function& a,
+                                 const vector<shared_ptr<op::Constant>>& b_constants)
+{
+    size_t next = 0;
+    for (const shared_ptr<Node>& node : a.get_ordered_ops())
+    {
+        auto a_constant = as_type_ptr<op::Constant>(node);
+        if (a_constant == nullptr)
+        {
+            continue;
+        }
+        if (next == b_constants.size())
+        {
+            return false;
+        }
+        const shared_ptr<op::Constant>& b_constant = b_constants[next++];
+        size_t size = shape_size(a_constant->get_shape()) * a_constant->get_element_type().size();
+        if (shape_size(b_constant->get_shape()) * b_constant->get_element_type().size() != size ||
+            memcmp(a_constant->get_data_ptr(), b_constant->get_data_ptr(), size) != 0)
+        {
+            return false;
+        }
+    }
+    return next == b_constants.size();
+}
@@ -0,0 +1,60 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/constant.hpp"
+
+namespace ngraph
+{
+    /// \brief Builds a canonical description of the structure of a function.
+    ///
+    /// The signature lists the ops in topological order with their type, version, attributes,
+    /// output element types and shapes, and the positions of the outputs feeding each input.
+    /// Constant payloads contribute a digest of their bytes. Node names do not take part, so
+    /// two separately built copies of the same graph have the same signature.
+    ///
+    /// \param function The function to describe
+    /// \param signature Receives the signature
+    /// \returns false if some op's attributes could not be inspected, in which case the
+    ///          signature cannot be used to tell functions apart
+    NGRAPH_API
+    bool get_structural_signature(const Function& function, std::string& signature);
+
+    /// \brief 64-bit FNV-1a hash of the structural signature of a function.
+    /// \returns false under the same conditions as get_structural_signature
+    NGRAPH_API
+    bool get_structural_hash(const Function& function, uint64_t& hash);
+
+    /// \brief 64-bit FNV-1a hash of a byte range
+    NGRAPH_API
+    uint64_t fnv1a_hash(const void* data, size_t size, uint64_t seed = 0xcbf29ce484222325ULL);
+
+    /// \brief Compares the constant payloads of two functions with equal structural
+    ///        signatures byte for byte, pairing constants in topological order.
+    NGRAPH_API
+    bool constant_data_equal(const Function& a, const Function& b);
+
+    /// \brief Compares the constant payloads of a function with the constants, in topological
+    ///        order, of a function with an equal structural signature.
+    NGRAPH_API
+    bool constant_data_equal(const Function& a,
+                             const std::vector<std::shared_ptr<op::Constant>>& b_constants);
+}
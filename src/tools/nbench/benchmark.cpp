@@ -172,6 +172,12 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
     t1.stop();
     float time = t1.get_milliseconds();
     ss << time / iterations << "ms per iteration" << endl;
+    runtime::PerformanceCounter call_perf = exec->get_call_performance_data();
+    if (call_perf.call_count() > 0)
+    {
+        ss << "call latency p50 " << call_perf.p50_microseconds() << "us, p99 "
+           << call_perf.p99_microseconds() << "us" << endl;
+    }
     cout << ss.str();
 
     if (dump_results)
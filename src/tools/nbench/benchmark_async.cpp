@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <future>
+
+#include "benchmark_async.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+vector<runtime::PerformanceCounter> run_benchmark_async(shared_ptr<Function> f,
+                                                        const string& backend_name,
+                                                        size_t iterations,
+                                                        bool timing_detail,
+                                                        size_t warmup_iterations,
+                                                        size_t in_flight)
+{
+    NGRAPH_CHECK(in_flight > 0, "async benchmark needs at least one request in flight");
+
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name);
+    auto exec = backend->compile(f, timing_detail);
+    timer.stop();
+    stringstream ss;
+    ss.imbue(locale(""));
+    ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+
+    // Each in-flight request owns its tensors so that calls never alias
+    vector<vector<shared_ptr<runtime::Tensor>>> args(in_flight);
+    vector<vector<shared_ptr<runtime::Tensor>>> results(in_flight);
+    for (size_t request = 0; request < in_flight; request++)
+    {
+        for (shared_ptr<op::Parameter> param : f->get_parameters())
+        {
+            auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+            random_init(tensor);
+            args[request].push_back(tensor);
+        }
+        for (shared_ptr<Node> out : f->get_results())
+        {
+            results[request].push_back(
+                backend->create_tensor(out->get_element_type(), out->get_shape()));
+        }
+    }
+    set_denormals_flush_to_zero();
+
+    vector<future<bool>> pending(in_flight);
+    auto wait_all = [&]() {
+        for (auto& call : pending)
+        {
+            if (call.valid())
+            {
+                call.get();
+            }
+        }
+    };
+
+    for (size_t i = 0; i < warmup_iterations; i++)
+    {
+        size_t request = i % in_flight;
+        if (pending[request].valid())
+        {
+            pending[request].get();
+        }
+        pending[request] = exec->async_call(results[request], args[request]);
+    }
+    wait_all();
+
+    stopwatch t1;
+    t1.start();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        size_t request = i % in_flight;
+        if (pending[request].valid())
+        {
+            pending[request].get();
+        }
+        pending[request] = exec->async_call(results[request], args[request]);
+    }
+    wait_all();
+    t1.stop();
+
+    float time = t1.get_milliseconds();
+    ss << time / iterations << "ms per iteration with " << in_flight << " in flight, "
+       << iterations * 1000.0 / time << " iterations per second" << endl;
+    cout << ss.str();
+
+    return exec->get_performance_data();
+}
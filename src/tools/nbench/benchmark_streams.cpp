@@ -0,0 +1,198 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+#include "benchmark_streams.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct Stream
+    {
+        vector<shared_ptr<runtime::Tensor>> args;
+        vector<shared_ptr<runtime::Tensor>> results;
+        runtime::LatencyHistogram latency;
+        chrono::nanoseconds time{0};
+        bool pinned{false};
+        size_t cpu{0};
+        exception_ptr error;
+    };
+}
+
+static void print_latency(ostream& out, const runtime::LatencyHistogram& latency)
+{
+    out << "p50 " << latency.get_percentile(50) / 1e6 << "ms, p95 "
+        << latency.get_percentile(95) / 1e6 << "ms, p99 " << latency.get_percentile(99) / 1e6
+        << "ms";
+}
+
+vector<runtime::PerformanceCounter> run_benchmark_streams(shared_ptr<Function> f,
+                                                          const string& backend_name,
+                                                          size_t iterations,
+                                                          bool timing_detail,
+                                                          size_t warmup_iterations,
+                                                          size_t streams,
+                                                          const vector<size_t>& pinned_cpus)
+{
+    NGRAPH_CHECK(streams > 0, "stream benchmark needs at least one stream");
+
+    // Performance counters are not updated atomically, so they are only gathered by one stream
+    bool collect_counters = timing_detail && streams == 1;
+    if (timing_detail && !collect_counters)
+    {
+        cout << "timing detail is not gathered with more than one stream" << endl;
+    }
+
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name);
+    auto exec = backend->compile(f, collect_counters);
+    timer.stop();
+    stringstream ss;
+    ss.imbue(locale(""));
+    ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+
+    // Tensors are created here since random_init is not thread safe
+    vector<Stream> state(streams);
+    for (Stream& stream : state)
+    {
+        for (shared_ptr<op::Parameter> param : f->get_parameters())
+        {
+            auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+            random_init(tensor);
+            stream.args.push_back(tensor);
+        }
+        for (shared_ptr<Node> out : f->get_results())
+        {
+            stream.results.push_back(
+                backend->create_tensor(out->get_element_type(), out->get_shape()));
+        }
+    }
+
+    // All streams warm up before any is timed, then start together
+    mutex gate_mutex;
+    condition_variable gate;
+    size_t ready = 0;
+    bool go = false;
+
+    auto run_stream = [&](size_t index) {
+        Stream& stream = state[index];
+        if (!pinned_cpus.empty())
+        {
+            stream.cpu = pinned_cpus[index % pinned_cpus.size()];
+            stream.pinned = pin_current_thread(stream.cpu);
+        }
+        set_denormals_flush_to_zero();
+        try
+        {
+            for (size_t i = 0; i < warmup_iterations; i++)
+            {
+                exec->call(stream.results, stream.args);
+            }
+        }
+        catch (...)
+        {
+            stream.error = current_exception();
+        }
+        {
+            unique_lock<mutex> lock(gate_mutex);
+            ready++;
+            gate.notify_all();
+            gate.wait(lock, [&]() { return go; });
+        }
+        if (stream.error)
+        {
+            return;
+        }
+        try
+        {
+            auto stream_start = chrono::high_resolution_clock::now();
+            for (size_t i = 0; i < iterations; i++)
+            {
+                auto call_start = chrono::high_resolution_clock::now();
+                exec->call(stream.results, stream.args);
+                stream.latency.add(chrono::high_resolution_clock::now() - call_start);
+            }
+            stream.time = chrono::high_resolution_clock::now() - stream_start;
+        }
+        catch (...)
+        {
+            stream.error = current_exception();
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t i = 0; i < streams; i++)
+    {
+        threads.emplace_back(run_stream, i);
+    }
+    chrono::high_resolution_clock::time_point start;
+    {
+        unique_lock<mutex> lock(gate_mutex);
+        gate.wait(lock, [&]() { return ready == streams; });
+        start = chrono::high_resolution_clock::now();
+        go = true;
+    }
+    gate.notify_all();
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    chrono::duration<double> total_time = chrono::high_resolution_clock::now() - start;
+    for (Stream& stream : state)
+    {
+        if (stream.error)
+        {
+            rethrow_exception(stream.error);
+        }
+    }
+
+    runtime::LatencyHistogram latency;
+    ss << fixed << setprecision(3);
+    for (size_t i = 0; i < streams; i++)
+    {
+        const Stream& stream = state[i];
+        chrono::duration<double> seconds = stream.time;
+        ss << "stream " << i;
+        if (!pinned_cpus.empty())
+        {
+            ss << (stream.pinned ? " on cpu " : " not pinned to cpu ") << stream.cpu;
+        }
+        ss << ": " << iterations / seconds.count() << " iterations per second, ";
+        print_latency(ss, stream.latency);
+        ss << endl;
+        latency.add(stream.latency);
+    }
+    ss << streams << " streams: " << streams * iterations / total_time.count()
+       << " iterations per second, ";
+    print_latency(ss, latency);
+    ss << endl;
+    cout << ss.str();
+
+    return exec->get_performance_data();
+}
@@ -0,0 +1,38 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+/// \brief Benchmarks `streams` threads each calling the same Executable with its own input and
+///        output tensors, reporting the throughput and latency percentiles of every stream and
+///        of all of them together.
+/// \param iterations Calls made by each stream
+/// \param pinned_cpus If not empty, stream i runs on pinned_cpus[i % pinned_cpus.size()]
+std::vector<ngraph::runtime::PerformanceCounter>
+    run_benchmark_streams(std::shared_ptr<ngraph::Function> f,
+                          const std::string& backend_name,
+                          size_t iterations,
+                          bool timing_detail,
+                          size_t warmup_iterations,
+                          size_t streams,
+                          const std::vector<size_t>& pinned_cpus);
@@ -17,6 +17,10 @@
 #if defined(__x86_64__) || defined(__amd64__)
 #include <xmmintrin.h>
 #endif
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include "benchmark_utils.hpp"
 #include "ngraph/file_util.hpp"
@@ -77,6 +81,23 @@ void set_denormals_flush_to_zero()
 #endif
 }
 
+bool pin_current_thread(size_t cpu)
+{
+#ifdef __linux__
+    if (cpu >= CPU_SETSIZE)
+    {
+        return false;
+    }
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
 void random_init(shared_ptr<runtime::Tensor> tensor)
 {
     element::Type et = tensor->get_element_type();
@@ -26,6 +26,10 @@
 
 void set_denormals_flush_to_zero();
 
+/// \brief Restricts the calling thread to one CPU
+/// \returns false if the platform does not support it or the CPU does not exist
+bool pin_current_thread(size_t cpu);
+
 void random_init(std::shared_ptr<ngraph::runtime::Tensor> tensor);
 
 std::default_random_engine& get_random_engine();
@@ -29,7 +29,9 @@
 #include <iomanip>
 
 #include "benchmark.hpp"
+#include "benchmark_async.hpp"
 #include "benchmark_pipelined.hpp"
+#include "benchmark_streams.hpp"
 #include "ngraph/distributed.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/file_util.hpp"
@@ -135,7 +137,65 @@ void print_times(const multimap<size_t, string>& timing)
     }
 }
 
-void print_results(vector<PerfShape> perf_data, bool timing_detail)
+// One row per op, slowest first. An op is compute bound when its arithmetic intensity is above
+// the ridge point peak_gflops / peak_gbps of the host, and "% roof" is how close it gets to the
+// attainable rate min(peak_gflops, intensity * peak_gbps). Without peaks only rates are shown.
+void print_roofline(const vector<PerfShape>& perf_data, double peak_gflops, double peak_gbps)
+{
+    bool have_peaks = peak_gflops > 0 && peak_gbps > 0;
+    size_t name_width = 4;
+    for (const PerfShape& p : perf_data)
+    {
+        name_width = max(name_width, p.get_node()->get_name().size());
+    }
+    cout << setw(name_width + 2) << left << "op" << right << setw(8) << "calls" << setw(11)
+         << "mean us" << setw(11) << "p50 us" << setw(11) << "p99 us" << setw(11) << "GFLOP/s"
+         << setw(11) << "GB/s" << setw(9) << "FLOP/B" << setw(10) << "bound" << setw(8)
+         << "% roof"
+         << "\n";
+    for (const PerfShape& p : perf_data)
+    {
+        if (p.call_count() == 0)
+        {
+            continue;
+        }
+        double intensity = p.arithmetic_intensity();
+        string bound = "-";
+        string roof = "-";
+        if (have_peaks)
+        {
+            double attainable;
+            double achieved;
+            if (p.flops() > 0)
+            {
+                bound = intensity * peak_gbps < peak_gflops ? "memory" : "compute";
+                attainable = min(peak_gflops, intensity * peak_gbps);
+                achieved = p.gflops_per_second();
+            }
+            else
+            {
+                bound = "memory";
+                attainable = peak_gbps;
+                achieved = p.gigabytes_per_second();
+            }
+            stringstream ss;
+            ss << fixed << setprecision(1) << 100 * achieved / attainable;
+            roof = ss.str();
+        }
+        cout << setw(name_width + 2) << left << p.get_node()->get_name() << right << fixed
+             << setprecision(2) << setw(8) << p.call_count() << setw(11)
+             << double(p.total_microseconds()) / p.call_count() << setw(11)
+             << p.p50_microseconds() << setw(11) << p.p99_microseconds() << setw(11)
+             << p.gflops_per_second() << setw(11) << p.gigabytes_per_second() << setw(9)
+             << intensity << setw(10) << bound << setw(8) << roof << "\n";
+    }
+    cout.unsetf(ios_base::floatfield);
+}
+
+void print_results(vector<PerfShape> perf_data,
+                   bool timing_detail,
+                   double peak_gflops = 0,
+                   double peak_gbps = 0)
 {
     sort(perf_data.begin(), perf_data.end(), [](const PerfShape& p1, const PerfShape& p2) {
         return p1.total_microseconds() > p2.total_microseconds();
@@ -150,6 +210,9 @@ void print_results(vector<PerfShape> perf_data, bool timing_detail)
 
         cout << "\n---- Aggregate times per op type/shape/count ----\n";
         print_times(timing_details);
+
+        cout << "\n---- Roofline per op ----\n";
+        print_roofline(perf_data, peak_gflops, peak_gbps);
     }
 }
 
@@ -168,6 +231,11 @@ int main(int argc, char** argv)
     bool dump_results = false;
     bool dot_file = false;
     bool double_buffer = false;
+    int async_in_flight = 0;
+    int streams = 0;
+    vector<size_t> pinned_cpus;
+    double peak_gflops = 0;
+    double peak_gbps = 0;
 
     for (int i = 1; i < argc; i++)
     {
@@ -224,6 +292,57 @@ int main(int argc, char** argv)
         {
             double_buffer = true;
         }
+        else if (arg == "--async")
+        {
+            try
+            {
+                async_in_flight = stoi(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--streams")
+        {
+            try
+            {
+                streams = stoi(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--pin")
+        {
+            try
+            {
+                for (const string& cpu : split(argv[++i], ',', true))
+                {
+                    pinned_cpus.push_back(stoul(cpu));
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--peak_gflops" || arg == "--peak_gbps")
+        {
+            try
+            {
+                (arg == "--peak_gflops" ? peak_gflops : peak_gbps) = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
             try
@@ -274,12 +393,17 @@ OPTIONS
         -i|--iterations           Iterations (default: 10)
         -s|--statistics           Display op statistics
         -v|--visualize            Visualize a model (WARNING: requires Graphviz installed)
-        --timing_detail           Gather detailed timing
+        --timing_detail           Gather detailed timing, with a per op roofline table
+        --peak_gflops <x>         Peak compute of the host, for the roofline table
+        --peak_gbps <x>           Peak memory bandwidth of the host, for the roofline table
         -w|--warmup_iterations    Number of warm-up iterations
         --no_copy_data            Disable copy of input/result data every iteration
         --dump_results            Dump result tensors to standard output.
         --dot                     Generate Graphviz dot file
         --double_buffer           Double buffer inputs and outputs
+        --async <n>               Issue calls with async_call keeping n requests in flight
+        --streams <n>             Call from n threads at once, each making <iterations> calls
+        --pin <cpu,cpu,...>       Pin stream i to the i-th listed CPU, wrapping around
 )###";
         return 1;
     }
@@ -401,6 +525,17 @@ OPTIONS
                      << " bytes in " << total_temporary_count << " temporaries\n";
                 cout << "Temporary size with reuse : "
                      << locale_string(f->get_temporary_pool_size()) << " bytes\n";
+                for (auto planner : {pass::MemoryLayout::Planner::OP_ORDER,
+                                     pass::MemoryLayout::Planner::GREEDY_BY_SIZE})
+                {
+                    pass::MemoryLayout layout(1, false, planner);
+                    layout.run_on_function(f);
+                    cout << (planner == pass::MemoryLayout::Planner::OP_ORDER ? "Op order"
+                                                                              : "Greedy by size")
+                         << " planner: " << locale_string(layout.get_allocated_bytes())
+                         << " bytes allocated for "
+                         << locale_string(layout.get_peak_live_bytes()) << " peak live bytes\n";
+                }
                 cout << "--\n";
                 cout << "Types used:\n";
                 for (const string& type : type_list)
@@ -432,6 +567,23 @@ OPTIONS
                     perf_data = run_benchmark_pipelined(
                         f, backend, iterations, timing_detail, warmup_iterations, copy_data);
                 }
+                else if (streams > 0)
+                {
+                    NGRAPH_CHECK(!dump_results, "'dump_results' not implemented in stream mode");
+                    perf_data = run_benchmark_streams(f,
+                                                      backend,
+                                                      iterations,
+                                                      timing_detail,
+                                                      warmup_iterations,
+                                                      streams,
+                                                      pinned_cpus);
+                }
+                else if (async_in_flight > 0)
+                {
+                    NGRAPH_CHECK(!dump_results, "'dump_results' not implemented in async mode");
+                    perf_data = run_benchmark_async(
+                        f, backend, iterations, timing_detail, warmup_iterations, async_in_flight);
+                }
                 else
                 {
                     perf_data = run_benchmark(f,
@@ -445,7 +597,7 @@ OPTIONS
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
                     aggregate_perf_data.end(), perf_shape.begin(), perf_shape.end());
-                print_results(perf_shape, timing_detail);
+                print_results(perf_shape, timing_detail, peak_gflops, peak_gbps);
             }
         }
         catch (ngraph::unsupported_op& ue)
@@ -466,7 +618,7 @@ OPTIONS
         cout << "============================================================================\n";
         cout << "---- Aggregate over all models\n";
         cout << "============================================================================\n";
-        print_results(aggregate_perf_data, timing_detail);
+        print_results(aggregate_perf_data, timing_detail, peak_gflops, peak_gbps);
     }
 
     return rc;
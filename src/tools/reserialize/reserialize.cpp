@@ -28,6 +28,7 @@
 #include <iostream>
 #include <string>
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/pass/constant_to_broadcast.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/serializer.hpp"
@@ -42,11 +43,15 @@ DESCRIPTION
     Reserialize a serialized model
 
 SYNOPSIS
-        reserialize [-i|--input <input file>] [-o|--output <output file>]
+        reserialize [-i|--input <input file>] [-o|--output <output file>] [-b|--binary]
+
+    The format of the input model, json or binary, is detected. After writing the output
+    model it is loaded again and its load time compared with that of the input.
 
 OPTIONS
         -i or --input  input serialized model
         -o or --output output serialized model
+        -b or --binary write the output in the memory mappable binary format instead of json
         -c or --constant_to_broacast Convert large constant constants to broadcast
 )###";
 }
@@ -56,6 +61,7 @@ int main(int argc, char** argv)
     string input;
     string output;
     bool c2b = false;
+    bool binary = false;
     for (int i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -67,6 +73,10 @@ int main(int argc, char** argv)
         {
             input = argv[++i];
         }
+        else if (arg == "-b" || arg == "--binary")
+        {
+            binary = true;
+        }
         else if (arg == "-c" || arg == "--constant_to_broadcast")
         {
             c2b = true;
@@ -92,32 +102,51 @@ int main(int argc, char** argv)
         return 1;
     }
 
-    ifstream f(input);
-    if (f)
+    if (!ngraph::file_util::exists(input))
     {
-        ngraph::stopwatch timer;
-        timer.start();
-        shared_ptr<ngraph::Function> function = ngraph::deserialize(f);
-        timer.stop();
-        cout << "deserialize took " << timer.get_milliseconds() << "ms\n";
+        cout << "failed to open '" << input << "' for input\n";
+        return 2;
+    }
 
-        if (c2b)
-        {
-            ngraph::pass::Manager pass_manager;
-            pass_manager.register_pass<ngraph::pass::ConstantToBroadcast>();
-            pass_manager.run_passes(function);
-        }
+    ngraph::stopwatch timer;
+    timer.start();
+    shared_ptr<ngraph::Function> function = ngraph::deserialize(input);
+    timer.stop();
+    size_t input_load_ms = timer.get_milliseconds();
+    cout << "deserialize took " << input_load_ms << "ms ("
+         << (ngraph::is_binary_model(input) ? "binary" : "json") << ")\n";
 
-        timer.start();
-        ngraph::serialize(output, function);
-        timer.stop();
-        cout << "serialize took   " << timer.get_milliseconds() << "ms\n";
+    if (c2b)
+    {
+        ngraph::pass::Manager pass_manager;
+        pass_manager.register_pass<ngraph::pass::ConstantToBroadcast>();
+        pass_manager.run_passes(function);
+    }
+
+    timer.start();
+    if (binary)
+    {
+        ngraph::serialize_binary(output, function);
     }
     else
     {
-        cout << "failed to open '" << input << "' for input\n";
-        return 2;
+        ngraph::serialize(output, function);
+    }
+    timer.stop();
+    cout << "serialize took   " << timer.get_milliseconds() << "ms ("
+         << (binary ? "binary" : "json") << ")\n";
+
+    timer.start();
+    function = ngraph::deserialize(output);
+    timer.stop();
+    size_t output_load_ms = timer.get_milliseconds();
+    cout << "reloading output took " << output_load_ms << "ms";
+    if (output_load_ms > 0)
+    {
+        cout << ", speedup over the input " << static_cast<double>(input_load_ms) / output_load_ms
+             << "x";
     }
+    cout << "\n";
 
     return 0;
 }
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <future>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close_f.hpp"
@@ -110,3 +113,68 @@ NGRAPH_TEST(${BACKEND_NAME}, get_parameters_and_results)
     //     EXPECT_NE(results[i], func_results[i]);
     // }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, async_call)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    const size_t in_flight = 8;
+    vector<shared_ptr<runtime::Tensor>> results;
+    vector<future<bool>> calls;
+    atomic<size_t> completed{0};
+    for (size_t i = 0; i < in_flight; i++)
+    {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>(4, static_cast<float>(i)));
+        results.push_back(result);
+        calls.push_back(handle->async_call({result}, {a, b}, [&completed](bool success) {
+            if (success)
+            {
+                completed++;
+            }
+        }));
+    }
+
+    for (size_t i = 0; i < in_flight; i++)
+    {
+        EXPECT_TRUE(calls[i].get());
+        vector<float> expected{1.0f + i, 2.0f + i, 3.0f + i, 4.0f + i};
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(results[i])));
+    }
+    EXPECT_EQ(completed, in_flight);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, async_call_destroy_after_get)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    // Performance counters force the calls through the serialized queue, whose drain job may
+    // still be running when the future becomes ready
+    for (size_t i = 0; i < 64; i++)
+    {
+        auto handle = backend->compile(f, true);
+        auto call = handle->async_call({result}, {a, b});
+        EXPECT_TRUE(call.get());
+        handle.reset();
+        EXPECT_TRUE(test::all_close_f((vector<float>{6, 8, 10, 12}), read_vector<float>(result)));
+    }
+}
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/test_case.hpp"
+#include "util/test_control.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, detection_output_corner)
+{
+    op::DetectionOutputAttrs attrs;
+    attrs.num_classes = 2;
+    attrs.keep_top_k = {3};
+    attrs.nms_threshold = 0.5f;
+    attrs.confidence_threshold = 0.01f;
+    attrs.normalized = true;
+    attrs.variance_encoded_in_target = true;
+
+    auto location = make_shared<op::Parameter>(element::f32, Shape{1, 8});
+    auto confidence = make_shared<op::Parameter>(element::f32, Shape{1, 4});
+    auto priors = make_shared<op::Parameter>(element::f32, Shape{1, 1, 8});
+    auto detection = make_shared<op::DetectionOutput>(location, confidence, priors, attrs);
+    auto f = make_shared<Function>(detection, ParameterVector{location, confidence, priors});
+
+    // Two priors overlapping with an IoU of 0.47 and no location offsets
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(vector<float>(8, 0.0f));
+    test_case.add_input<float>({0.1f, 0.9f, 0.2f, 0.8f});
+    test_case.add_input<float>({0.0f, 0.0f, 0.5f, 0.5f, 0.1f, 0.1f, 0.6f, 0.6f});
+    test_case.add_expected_output<float>({0,  1, 0.9f, 0.0f, 0.0f, 0.5f, 0.5f,
+                                          0,  1, 0.8f, 0.1f, 0.1f, 0.6f, 0.6f,
+                                          -1, 0, 0,    0,    0,    0,    0});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, detection_output_corner_suppressed)
+{
+    op::DetectionOutputAttrs attrs;
+    attrs.num_classes = 2;
+    attrs.keep_top_k = {3};
+    attrs.nms_threshold = 0.4f;
+    attrs.confidence_threshold = 0.01f;
+    attrs.normalized = true;
+    attrs.variance_encoded_in_target = true;
+
+    auto location = make_shared<op::Parameter>(element::f32, Shape{1, 8});
+    auto confidence = make_shared<op::Parameter>(element::f32, Shape{1, 4});
+    auto priors = make_shared<op::Parameter>(element::f32, Shape{1, 1, 8});
+    auto detection = make_shared<op::DetectionOutput>(location, confidence, priors, attrs);
+    auto f = make_shared<Function>(detection, ParameterVector{location, confidence, priors});
+
+    // The IoU of 0.47 is above the threshold, so only the better scored prior is kept
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(vector<float>(8, 0.0f));
+    test_case.add_input<float>({0.1f, 0.9f, 0.2f, 0.8f});
+    test_case.add_input<float>({0.0f, 0.0f, 0.5f, 0.5f, 0.1f, 0.1f, 0.6f, 0.6f});
+    test_case.add_expected_output<float>({0,  1, 0.9f, 0.0f, 0.0f, 0.5f, 0.5f,
+                                          -1, 0, 0,    0,    0,    0,    0,
+                                          -1, 0, 0,    0,    0,    0,    0});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, detection_output_center_size_keep_top_k)
+{
+    op::DetectionOutputAttrs attrs;
+    attrs.num_classes = 4;
+    attrs.keep_top_k = {2};
+    attrs.code_type = "caffe.PriorBoxParameter.CENTER_SIZE";
+    attrs.nms_threshold = 0.5f;
+    attrs.confidence_threshold = 0.01f;
+    attrs.normalized = true;
+
+    auto location = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto confidence = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto priors = make_shared<op::Parameter>(element::f32, Shape{1, 2, 4});
+    auto detection = make_shared<op::DetectionOutput>(location, confidence, priors, attrs);
+    auto f = make_shared<Function>(detection, ParameterVector{location, confidence, priors});
+
+    // Moves the center right by 0.1 * 1 * 0.4 in the first image and doubles the size in the
+    // second, as exp(0.2 * 5 * ln(2)) = 2
+    float size_offset = 5 * std::log(2.0f);
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>({1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, size_offset, size_offset});
+    // The background score is ignored and keep_top_k keeps the best two of the three classes
+    // of each image, which are then written by ascending label
+    test_case.add_input<float>({0.99f, 0.3f, 0.6f, 0.1f, 0.99f, 0.7f, 0.2f, 0.5f});
+    // One prior of width and height 0.4 centered at (0.5, 0.5), with its variances in the
+    // second row
+    test_case.add_input<float>({0.3f, 0.3f, 0.7f, 0.7f, 0.1f, 0.1f, 0.2f, 0.2f});
+    test_case.add_expected_output<float>({0, 1, 0.3f, 0.34f, 0.3f, 0.74f, 0.7f,
+                                          0, 2, 0.6f, 0.34f, 0.3f, 0.74f, 0.7f,
+                                          1, 1, 0.7f, 0.1f,  0.1f, 0.9f,  0.9f,
+                                          1, 3, 0.5f, 0.1f,  0.1f, 0.9f,  0.9f});
+    test_case.run();
+}
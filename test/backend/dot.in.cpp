@@ -254,6 +254,60 @@ NGRAPH_TEST(${BACKEND_NAME}, dot_0_0)
     EXPECT_TRUE(test::all_close_f((vector<float>{0}), read_vector<float>(result)));
 }
 
+// Large enough to span several row, column and reduction blocks of the blocked kernel
+NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_across_blocks)
+{
+    const size_t m = 37;
+    const size_t k = 300;
+    const size_t n = 150;
+    Shape shape_a{m, k};
+    Shape shape_b{k, n};
+    Shape shape_r{m, n};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> a_data(m * k);
+    vector<float> b_data(k * n);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t r = 0; r < k; r++)
+        {
+            a_data[i * k + r] = static_cast<float>((i + r) % 7) - 3;
+        }
+    }
+    for (size_t r = 0; r < k; r++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            b_data[r * n + j] = static_cast<float>((r * j) % 5) - 2;
+        }
+    }
+    vector<float> expected(m * n, 0);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t r = 0; r < k; r++)
+            {
+                expected[i * n + j] += a_data[i * k + r] * b_data[r * n + j];
+            }
+        }
+    }
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, MLIR_DISABLE_TEST(dot_matrix_2x0_0x2))
 {
     Shape shape_a{2, 0};
@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -292,3 +293,97 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_reverse_shape)
                         Shape{8, 2, 8, 2},
                         Shape{2, 3, 4, 5, 2}});
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_cache_hit_miss_eviction)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic()});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic()});
+    auto f = make_shared<Function>(NodeVector{a + b}, ParameterVector{a, b});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = backend->compile(f);
+    auto dyn_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex);
+    ASSERT_NE(dyn_ex, nullptr);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape{Dimension::dynamic()});
+    auto run = [&](size_t n) {
+        vector<float> inputs(n, 1.0f);
+        auto t_a = backend->create_tensor(element::f32, Shape{n});
+        auto t_b = backend->create_tensor(element::f32, Shape{n});
+        copy_data(t_a, inputs);
+        copy_data(t_b, inputs);
+        ex->call_with_validate({t_r}, {t_a, t_b});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), vector<float>(n, 2.0f)));
+    };
+
+    run(2);
+    run(3);
+    run(2);
+    run(3);
+    EXPECT_EQ(dyn_ex->get_cache_miss_count(), 2);
+    EXPECT_EQ(dyn_ex->get_cache_hit_count(), 2);
+    EXPECT_EQ(dyn_ex->get_cache_eviction_count(), 0);
+    EXPECT_EQ(dyn_ex->get_cache()->get_entry_count(), 2);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_shape_bucketing)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto f = make_shared<Function>(NodeVector{a * b}, ParameterVector{a, b});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    string error;
+    ASSERT_TRUE(backend->set_config({{"shape_bucket_axis", "0"}, {"shape_buckets", "4,8"}}, error))
+        << error;
+    auto ex = backend->compile(f);
+    auto dyn_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex);
+    ASSERT_NE(dyn_ex, nullptr);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape{Dimension::dynamic(), 2});
+    for (size_t n : {1, 3, 4, 2, 6, 9})
+    {
+        vector<float> inputs(n * 2);
+        vector<float> expected(n * 2);
+        for (size_t i = 0; i < n * 2; i++)
+        {
+            inputs[i] = i + 1;
+            expected[i] = (i + 1) * (i + 1);
+        }
+        auto t_a = backend->create_tensor(element::f32, Shape{n, 2});
+        auto t_b = backend->create_tensor(element::f32, Shape{n, 2});
+        copy_data(t_a, inputs);
+        copy_data(t_b, inputs);
+        ex->call_with_validate({t_r}, {t_a, t_b});
+
+        ASSERT_EQ(t_r->get_shape(), (Shape{n, 2}));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected));
+    }
+
+    // Buckets 4 and 8 serve n = 1..8; n = 9 exceeds the largest bucket and is compiled exactly.
+    EXPECT_EQ(dyn_ex->get_cache_miss_count(), 3);
+    EXPECT_EQ(dyn_ex->get_cache_hit_count(), 3);
+
+    EXPECT_FALSE(backend->set_config({{"shape_buckets", "8,4"}}, error));
+    EXPECT_FALSE(backend->set_config({{"shape_buckets", "-1,4"}}, error));
+    EXPECT_FALSE(backend->set_config({{"shape_bucket_axis", "-1"}}, error));
+    EXPECT_FALSE(
+        backend->set_config({{"shape_buckets", "2"}, {"unsupported_option", "1"}}, error));
+
+    // A rejected config leaves the earlier bucketing in place for later compiles
+    auto ex2 = backend->compile(f);
+    auto dyn_ex2 = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex2);
+    ASSERT_NE(dyn_ex2, nullptr);
+    for (size_t n : {1, 3})
+    {
+        vector<float> inputs(n * 2, 1.0f);
+        auto t_a = backend->create_tensor(element::f32, Shape{n, 2});
+        auto t_b = backend->create_tensor(element::f32, Shape{n, 2});
+        copy_data(t_a, inputs);
+        copy_data(t_b, inputs);
+        ex2->call_with_validate({t_r}, {t_a, t_b});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), inputs));
+    }
+    EXPECT_EQ(dyn_ex2->get_cache_miss_count(), 1);
+    EXPECT_EQ(dyn_ex2->get_cache_hit_count(), 1);
+}
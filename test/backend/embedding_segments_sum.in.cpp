@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_case.hpp"
+#include "util/test_control.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_segments_sum)
+{
+    auto table = make_shared<op::Parameter>(element::f32, Shape{5, 2});
+    auto indices = op::Constant::create(element::i64, Shape{4}, {0, 2, 3, 4});
+    auto segment_ids = op::Constant::create(element::i64, Shape{4}, {0, 0, 2, 2});
+    auto num_segments = op::Constant::create(element::i64, Shape{}, {3});
+    auto embedding_segments =
+        make_shared<op::v3::EmbeddingSegmentsSum>(table, indices, segment_ids, num_segments);
+    auto f = make_shared<Function>(embedding_segments, ParameterVector{table});
+
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>({0, 1, 10, 11, 20, 21, 30, 31, 40, 41});
+    // Segment 1 has no indices and there is no default index, so it is zero
+    test_case.add_expected_output<float>({20, 22, 0, 0, 70, 72});
+    test_case.run(MIN_FLOAT_TOLERANCE_BITS);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_segments_sum_default_index_weights)
+{
+    auto table = make_shared<op::Parameter>(element::f32, Shape{5, 2});
+    auto indices = op::Constant::create(element::i32, Shape{4}, {0, 2, 3, 4});
+    auto segment_ids = op::Constant::create(element::i32, Shape{4}, {0, 0, 2, 2});
+    auto num_segments = op::Constant::create(element::i32, Shape{}, {4});
+    auto default_index = op::Constant::create(element::i32, Shape{}, {1});
+    auto weights = op::Constant::create(element::f32, Shape{4}, {0.5f, 0.5f, 1.0f, 2.0f});
+    auto embedding_segments = make_shared<op::v3::EmbeddingSegmentsSum>(
+        table, indices, segment_ids, num_segments, default_index, weights);
+    auto f = make_shared<Function>(embedding_segments, ParameterVector{table});
+
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>({0, 1, 10, 11, 20, 21, 30, 31, 40, 41});
+    test_case.add_expected_output<float>({10, 11, 10, 11, 110, 113, 10, 11});
+    test_case.run(MIN_FLOAT_TOLERANCE_BITS);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_segments_sum_unsorted_ids)
+{
+    auto table = make_shared<op::Parameter>(element::f32, Shape{5, 2});
+    auto indices = op::Constant::create(element::i64, Shape{4}, {0, 2, 3, 4});
+    auto segment_ids = op::Constant::create(element::i64, Shape{4}, {2, 0, 2, 0});
+    auto num_segments = op::Constant::create(element::i64, Shape{}, {3});
+    auto embedding_segments =
+        make_shared<op::v3::EmbeddingSegmentsSum>(table, indices, segment_ids, num_segments);
+    auto f = make_shared<Function>(embedding_segments, ParameterVector{table});
+
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>({0, 1, 10, 11, 20, 21, 30, 31, 40, 41});
+    test_case.add_expected_output<float>({60, 62, 0, 0, 30, 32});
+    test_case.run(MIN_FLOAT_TOLERANCE_BITS);
+}
@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <numeric>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_case.hpp"
+#include "util/test_control.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_nearest_upsample)
+{
+    op::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{2, 3};
+    attrs.mode = "nearest";
+    attrs.align_corners = false;
+
+    auto image = make_shared<op::Parameter>(element::f32, Shape{1, 1, 2, 2});
+    auto output_shape = op::Constant::create(element::i64, Shape{2}, {4, 4});
+    auto interpolate = make_shared<op::Interpolate>(image, output_shape, attrs);
+    auto f = make_shared<Function>(interpolate, ParameterVector{image});
+
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 4, 4});
+    test_case.run(MIN_FLOAT_TOLERANCE_BITS);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_linear_align_corners)
+{
+    op::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{2, 3};
+    attrs.mode = "linear";
+    attrs.align_corners = true;
+
+    auto image = make_shared<op::Parameter>(element::f32, Shape{1, 1, 2, 2});
+    auto output_shape = op::Constant::create(element::i64, Shape{2}, {3, 3});
+    auto interpolate = make_shared<op::Interpolate>(image, output_shape, attrs);
+    auto f = make_shared<Function>(interpolate, ParameterVector{image});
+
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({1, 1.5f, 2, 2, 2.5f, 3, 3, 3.5f, 4});
+    test_case.run(MIN_FLOAT_TOLERANCE_BITS);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_linear_downsample)
+{
+    op::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{2, 3};
+    attrs.mode = "linear";
+    attrs.align_corners = false;
+
+    auto image = make_shared<op::Parameter>(element::f32, Shape{1, 1, 4, 4});
+    auto output_shape = op::Constant::create(element::i64, Shape{2}, {2, 2});
+    auto interpolate = make_shared<op::Interpolate>(image, output_shape, attrs);
+    auto f = make_shared<Function>(interpolate, ParameterVector{image});
+
+    // Pixel (y, x) is 4 * y + x, so bilinear samples at (0.5, 0.5), (0.5, 2.5), (2.5, 0.5)
+    // and (2.5, 2.5) reproduce the plane exactly
+    vector<float> image_data(16);
+    iota(image_data.begin(), image_data.end(), 0.0f);
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(image_data);
+    test_case.add_expected_output<float>({2.5f, 4.5f, 10.5f, 12.5f});
+    test_case.run(MIN_FLOAT_TOLERANCE_BITS);
+}
@@ -90,6 +90,159 @@ NGRAPH_TEST(${BACKEND_NAME}, layer_norm_affine_stats)
     EXPECT_TRUE(test::all_close_f(exp_var, read_vector<float>(var)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, layer_norm_no_affine_no_stats)
+{
+    auto p_data = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto ln = make_shared<op::LayerNorm>(p_data, false);
+    auto f = make_shared<Function>(ln->outputs(), ParameterVector{p_data});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto data = backend->create_tensor(element::f32, Shape{2, 4});
+    copy_data(data, vector<float>{-4.0f, -3.0f, -2.0f, -1.0f, 0.0f, 1.0f, 2.0f, 3.0f});
+    auto norm = backend->create_tensor(element::f32, Shape{2, 4});
+
+    vector<float> exp_norm{-1.341635420f,
+                           -0.447211807f,
+                           0.447211807f,
+                           1.341635420f,
+                           -1.341635420f,
+                           -0.447211807f,
+                           0.447211807f,
+                           1.341635420f};
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({norm}, {data});
+    EXPECT_TRUE(test::all_close_f(exp_norm, read_vector<float>(norm)));
+}
+
+// Two-pass double precision LayerNorm over the trailing cols elements of each row
+static void layer_norm_expected(const vector<float>& data,
+                                const vector<float>& scale,
+                                const vector<float>& bias,
+                                size_t cols,
+                                vector<float>& norm,
+                                vector<float>& mean,
+                                vector<float>& var)
+{
+    size_t rows = data.size() / cols;
+    norm.resize(data.size());
+    mean.resize(rows);
+    var.resize(rows);
+    for (size_t r = 0; r < rows; r++)
+    {
+        double m = 0;
+        for (size_t j = 0; j < cols; j++)
+        {
+            m += data[r * cols + j];
+        }
+        m /= cols;
+        double v = 0;
+        for (size_t j = 0; j < cols; j++)
+        {
+            v += (data[r * cols + j] - m) * (data[r * cols + j] - m);
+        }
+        v /= cols;
+        for (size_t j = 0; j < cols; j++)
+        {
+            norm[r * cols + j] = static_cast<float>((data[r * cols + j] - m) / sqrt(v + 1e-5) *
+                                                        scale[j] +
+                                                    bias[j]);
+        }
+        mean[r] = static_cast<float>(m);
+        var[r] = static_cast<float>(v);
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, layer_norm_bert_hidden)
+{
+    // BERT-base activations: hidden size 768, normalized over the last axis
+    Shape shape{2, 5, 768};
+    auto p_data = make_shared<op::Parameter>(element::f32, shape);
+    auto p_scale = make_shared<op::Parameter>(element::f32, Shape{768});
+    auto p_bias = make_shared<op::Parameter>(element::f32, Shape{768});
+    auto ln = make_shared<op::LayerNorm>(p_data, p_scale, p_bias, true, -1);
+    auto f = make_shared<Function>(ln->outputs(), ParameterVector{p_data, p_scale, p_bias});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> d_input(shape_size(shape));
+    for (size_t i = 0; i < d_input.size(); i++)
+    {
+        // A large offset checks that the variance does not cancel catastrophically
+        d_input[i] = 100.0f + static_cast<float>(sin(0.37 * i) * (1 + i % 7));
+    }
+    vector<float> s_input(768);
+    vector<float> b_input(768);
+    for (size_t i = 0; i < 768; i++)
+    {
+        s_input[i] = 0.5f + static_cast<float>(i % 5) * 0.25f;
+        b_input[i] = static_cast<float>(i % 3) - 1.0f;
+    }
+    vector<float> exp_norm, exp_mean, exp_var;
+    layer_norm_expected(d_input, s_input, b_input, 768, exp_norm, exp_mean, exp_var);
+
+    auto data = backend->create_tensor(element::f32, shape);
+    auto scale = backend->create_tensor(element::f32, Shape{768});
+    auto bias = backend->create_tensor(element::f32, Shape{768});
+    copy_data(data, d_input);
+    copy_data(scale, s_input);
+    copy_data(bias, b_input);
+    auto norm = backend->create_tensor(element::f32, shape);
+    auto mean = backend->create_tensor(element::f32, Shape{2, 5});
+    auto var = backend->create_tensor(element::f32, Shape{2, 5});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({norm, mean, var}, {data, scale, bias});
+    EXPECT_TRUE(test::all_close(exp_norm, read_vector<float>(norm), 1e-4f, 1e-4f));
+    EXPECT_TRUE(test::all_close(exp_mean, read_vector<float>(mean), 1e-5f, 1e-5f));
+    EXPECT_TRUE(test::all_close(exp_var, read_vector<float>(var), 1e-4f, 1e-4f));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, layer_norm_4d_input)
+{
+    // Normalizes over the last two axes with a matching two dimensional scale
+    Shape shape{2, 2, 3, 4};
+    auto p_data = make_shared<op::Parameter>(element::f32, shape);
+    auto p_scale = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto p_bias = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto ln = make_shared<op::LayerNorm>(p_data, p_scale, p_bias, true, 2);
+    auto f = make_shared<Function>(ln->outputs(), ParameterVector{p_data, p_scale, p_bias});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> d_input(shape_size(shape));
+    for (size_t i = 0; i < d_input.size(); i++)
+    {
+        d_input[i] = static_cast<float>((i * 7) % 11) - 5.0f;
+    }
+    vector<float> s_input(12);
+    vector<float> b_input(12);
+    for (size_t i = 0; i < 12; i++)
+    {
+        s_input[i] = static_cast<float>(i) * 0.1f - 0.5f;
+        b_input[i] = static_cast<float>(i % 4);
+    }
+    vector<float> exp_norm, exp_mean, exp_var;
+    layer_norm_expected(d_input, s_input, b_input, 12, exp_norm, exp_mean, exp_var);
+
+    auto data = backend->create_tensor(element::f32, shape);
+    auto scale = backend->create_tensor(element::f32, Shape{3, 4});
+    auto bias = backend->create_tensor(element::f32, Shape{3, 4});
+    copy_data(data, d_input);
+    copy_data(scale, s_input);
+    copy_data(bias, b_input);
+    auto norm = backend->create_tensor(element::f32, shape);
+    auto mean = backend->create_tensor(element::f32, Shape{2, 2});
+    auto var = backend->create_tensor(element::f32, Shape{2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({norm, mean, var}, {data, scale, bias});
+    EXPECT_TRUE(test::all_close(exp_norm, read_vector<float>(norm), 1e-5f, 1e-5f));
+    EXPECT_TRUE(test::all_close(exp_mean, read_vector<float>(mean), 1e-5f, 1e-5f));
+    EXPECT_TRUE(test::all_close(exp_var, read_vector<float>(var), 1e-5f, 1e-5f));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, layer_norm_bprop_affine_stats)
 {
     auto p_data = make_shared<op::Parameter>(element::f32, Shape{2, 4});
@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/test_case.hpp"
+#include "util/test_control.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// Six boxes in three overlapping pairs, as used by the ONNX NonMaxSuppression tests
+static const vector<float> s_corner_boxes{0.0f, 0.0f,  1.0f, 1.0f,  0.0f, 0.1f,   1.0f, 1.1f,
+                                          0.0f, -0.1f, 1.0f, 0.9f,  0.0f, 10.0f,  1.0f, 11.0f,
+                                          0.0f, 10.1f, 1.0f, 11.1f, 0.0f, 100.0f, 1.0f, 101.0f};
+static const vector<float> s_scores{0.9f, 0.75f, 0.6f, 0.95f, 0.5f, 0.3f};
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_center_point_box)
+{
+    auto boxes = make_shared<op::Parameter>(element::f32, Shape{1, 6, 4});
+    auto scores = make_shared<op::Parameter>(element::f32, Shape{1, 1, 6});
+    auto nms = make_shared<op::v1::NonMaxSuppression>(
+        boxes,
+        scores,
+        op::Constant::create(element::i64, Shape{}, {3}),
+        op::Constant::create(element::f32, Shape{}, {0.5f}),
+        op::Constant::create(element::f32, Shape{}, {0.0f}),
+        op::v1::NonMaxSuppression::BoxEncodingType::CENTER,
+        false);
+    auto f = make_shared<Function>(nms, ParameterVector{boxes, scores});
+
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>({0.5f, 0.5f,  1.0f, 1.0f, 0.5f, 0.6f,   1.0f, 1.0f,
+                                0.5f, 0.4f,  1.0f, 1.0f, 0.5f, 10.5f,  1.0f, 1.0f,
+                                0.5f, 10.6f, 1.0f, 1.0f, 0.5f, 100.5f, 1.0f, 1.0f});
+    test_case.add_input<float>(s_scores);
+    test_case.add_expected_output<int64_t>({0, 0, 3, 0, 0, 0, 0, 0, 5});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_suppress_by_iou)
+{
+    auto boxes = make_shared<op::Parameter>(element::f32, Shape{1, 6, 4});
+    auto scores = make_shared<op::Parameter>(element::f32, Shape{1, 1, 6});
+    auto nms = make_shared<op::v1::NonMaxSuppression>(
+        boxes,
+        scores,
+        op::Constant::create(element::i64, Shape{}, {3}),
+        op::Constant::create(element::f32, Shape{}, {0.5f}),
+        op::Constant::create(element::f32, Shape{}, {0.0f}),
+        op::v1::NonMaxSuppression::BoxEncodingType::CORNER,
+        false);
+    auto f = make_shared<Function>(nms, ParameterVector{boxes, scores});
+
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(s_corner_boxes);
+    test_case.add_input<float>(s_scores);
+    test_case.add_expected_output<int64_t>({0, 0, 3, 0, 0, 0, 0, 0, 5});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_score_threshold)
+{
+    auto boxes = make_shared<op::Parameter>(element::f32, Shape{1, 6, 4});
+    auto scores = make_shared<op::Parameter>(element::f32, Shape{1, 1, 6});
+    auto nms = make_shared<op::v1::NonMaxSuppression>(
+        boxes,
+        scores,
+        op::Constant::create(element::i64, Shape{}, {3}),
+        op::Constant::create(element::f32, Shape{}, {0.5f}),
+        op::Constant::create(element::f32, Shape{}, {0.4f}),
+        op::v1::NonMaxSuppression::BoxEncodingType::CORNER,
+        false);
+    auto f = make_shared<Function>(nms, ParameterVector{boxes, scores});
+
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(s_corner_boxes);
+    test_case.add_input<float>(s_scores);
+    // Only two boxes pass the threshold, the remaining row is padded with -1
+    test_case.add_expected_output<int64_t>({0, 0, 3, 0, 0, 0, -1, -1, -1});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_two_classes)
+{
+    auto boxes = make_shared<op::Parameter>(element::f32, Shape{1, 6, 4});
+    auto scores = make_shared<op::Parameter>(element::f32, Shape{1, 2, 6});
+    auto nms = make_shared<op::v1::NonMaxSuppression>(
+        boxes,
+        scores,
+        op::Constant::create(element::i64, Shape{}, {2}),
+        op::Constant::create(element::f32, Shape{}, {0.5f}),
+        op::Constant::create(element::f32, Shape{}, {0.0f}),
+        op::v1::NonMaxSuppression::BoxEncodingType::CORNER,
+        false);
+    auto f = make_shared<Function>(nms, ParameterVector{boxes, scores});
+
+    vector<float> two_class_scores = s_scores;
+    two_class_scores.insert(two_class_scores.end(), s_scores.begin(), s_scores.end());
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(s_corner_boxes);
+    test_case.add_input<float>(two_class_scores);
+    test_case.add_expected_output<int64_t>({0, 0, 3, 0, 0, 0, 0, 1, 3, 0, 1, 0});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_two_classes_sorted)
+{
+    auto boxes = make_shared<op::Parameter>(element::f32, Shape{1, 6, 4});
+    auto scores = make_shared<op::Parameter>(element::f32, Shape{1, 2, 6});
+    auto nms = make_shared<op::v1::NonMaxSuppression>(
+        boxes,
+        scores,
+        op::Constant::create(element::i64, Shape{}, {2}),
+        op::Constant::create(element::f32, Shape{}, {0.5f}),
+        op::Constant::create(element::f32, Shape{}, {0.0f}),
+        op::v1::NonMaxSuppression::BoxEncodingType::CORNER,
+        true);
+    auto f = make_shared<Function>(nms, ParameterVector{boxes, scores});
+
+    vector<float> two_class_scores = s_scores;
+    two_class_scores.insert(two_class_scores.end(), s_scores.begin(), s_scores.end());
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(s_corner_boxes);
+    test_case.add_input<float>(two_class_scores);
+    // Sorting by score interleaves the two classes
+    test_case.add_expected_output<int64_t>({0, 0, 3, 0, 1, 3, 0, 0, 0, 0, 1, 0});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_v3_i32)
+{
+    auto boxes = make_shared<op::Parameter>(element::f32, Shape{1, 6, 4});
+    auto scores = make_shared<op::Parameter>(element::f32, Shape{1, 1, 6});
+    auto nms = make_shared<op::v3::NonMaxSuppression>(
+        boxes,
+        scores,
+        op::Constant::create(element::i32, Shape{}, {5}),
+        op::Constant::create(element::f32, Shape{}, {0.5f}),
+        op::Constant::create(element::f32, Shape{}, {0.0f}),
+        op::v3::NonMaxSuppression::BoxEncodingType::CORNER,
+        true,
+        element::i32);
+    auto f = make_shared<Function>(nms, ParameterVector{boxes, scores});
+
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(s_corner_boxes);
+    test_case.add_input<float>(s_scores);
+    test_case.add_expected_output<int32_t>({0, 0, 3, 0, 0, 0, 0, 0, 5, -1, -1, -1, -1, -1, -1});
+    test_case.run();
+}
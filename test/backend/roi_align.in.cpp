@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <numeric>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_case.hpp"
+#include "util/test_control.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// The tests use two images of one 4x4 channel where pixel (y, x) is 4 * y + x, plus 16 in the
+// second image. Bilinear samples inside the image then equal 4 * y + x exactly.
+
+NGRAPH_TEST(${BACKEND_NAME}, roi_align_avg)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 1, 4, 4});
+    auto rois = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto batch_indices = op::Constant::create(element::i64, Shape{2}, {0, 1});
+    auto roi_align =
+        make_shared<op::v3::ROIAlign>(data, rois, batch_indices, 2, 2, 2, 1.0f, "avg");
+    auto f = make_shared<Function>(roi_align, ParameterVector{data, rois});
+
+    vector<float> planes(32);
+    iota(planes.begin(), planes.end(), 0.0f);
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(planes);
+    // The same ROI on both images, each 2x2 bin averaging four samples around its center
+    test_case.add_input<float>({0, 0, 2, 2, 0, 0, 2, 2});
+    test_case.add_expected_output<float>({2.5f, 3.5f, 6.5f, 7.5f, 18.5f, 19.5f, 22.5f, 23.5f});
+    test_case.run(MIN_FLOAT_TOLERANCE_BITS);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, roi_align_max)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 1, 4, 4});
+    auto rois = make_shared<op::Parameter>(element::f32, Shape{1, 4});
+    auto batch_indices = op::Constant::create(element::i64, Shape{1}, {0});
+    auto roi_align =
+        make_shared<op::v3::ROIAlign>(data, rois, batch_indices, 2, 2, 2, 1.0f, "max");
+    auto f = make_shared<Function>(roi_align, ParameterVector{data, rois});
+
+    vector<float> planes(32);
+    iota(planes.begin(), planes.end(), 0.0f);
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(planes);
+    test_case.add_input<float>({0, 0, 2, 2});
+    // The largest sample of each bin is its bottom right one
+    test_case.add_expected_output<float>({3.75f, 4.75f, 7.75f, 8.75f});
+    test_case.run(MIN_FLOAT_TOLERANCE_BITS);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, roi_align_border_i32)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 1, 4, 4});
+    auto rois = make_shared<op::Parameter>(element::f32, Shape{1, 4});
+    auto batch_indices = op::Constant::create(element::i32, Shape{1}, {1});
+    auto roi_align =
+        make_shared<op::v3::ROIAlign>(data, rois, batch_indices, 1, 1, 2, 1.0f, "avg");
+    auto f = make_shared<Function>(roi_align, ParameterVector{data, rois});
+
+    vector<float> planes(32);
+    iota(planes.begin(), planes.end(), 0.0f);
+    auto test_case = test::NgraphTestCase(f, "${BACKEND_NAME}");
+    test_case.add_input<float>(planes);
+    test_case.add_input<float>({2, 2, 4, 4});
+    // Samples at 2.5 and 3.5 along each axis, the latter clamped to the last pixel at 3
+    test_case.add_expected_output<float>({16 + 4 * 2.75f + 2.75f});
+    test_case.run(MIN_FLOAT_TOLERANCE_BITS);
+}
@@ -17,6 +17,7 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -74,3 +75,129 @@ TEST(INTERPRETER, nan_check_output)
     ihandle->set_nan_check(true);
     EXPECT_ANY_THROW(handle->call_with_validate({result}, {a, b}));
 }
+
+TEST(INTERPRETER, planned_call_reuses_arena)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto sum = make_shared<op::Add>(A, B);
+    auto product = make_shared<op::Multiply>(sum, sum);
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Subtract>(product, C), sum},
+                                   ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto result_sum = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{0, 1, 0, 1});
+    handle->call_with_validate({result, result_sum}, {a, b});
+    EXPECT_EQ((vector<float>{0, 8, 8, 24}), read_vector<float>(result));
+    EXPECT_EQ((vector<float>{1, 3, 3, 5}), read_vector<float>(result_sum));
+    shared_ptr<runtime::interpreter::INTExecutable> ihandle =
+        static_pointer_cast<runtime::interpreter::INTExecutable>(handle);
+    auto arenas = ihandle->get_idle_arenas();
+    ASSERT_EQ(arenas.size(), 1);
+    EXPECT_NE(arenas[0].first, nullptr);
+    EXPECT_GT(arenas[0].second, 0);
+
+    // A second call runs out of the same arena and must not see stale intermediates
+    auto c = backend->create_tensor(element::f32, shape);
+    copy_data(c, vector<float>{2, 2, 2, 2});
+    handle->call_with_validate({result, result_sum}, {c, b});
+    EXPECT_EQ((vector<float>{3, 8, 3, 8}), read_vector<float>(result));
+    EXPECT_EQ((vector<float>{2, 3, 2, 3}), read_vector<float>(result_sum));
+    EXPECT_EQ(ihandle->get_idle_arenas(), arenas);
+}
+
+TEST(INTERPRETER, performance_counters)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{8, 2});
+    auto dot = make_shared<op::Dot>(A, B);
+    auto add = make_shared<op::Add>(dot, dot);
+    auto f = make_shared<Function>(add, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, Shape{4, 8});
+    copy_data(a, vector<float>(32, 1));
+    auto b = backend->create_tensor(element::f32, Shape{8, 2});
+    copy_data(b, vector<float>(16, 1));
+    auto result = backend->create_tensor(element::f32, Shape{4, 2});
+
+    shared_ptr<runtime::Executable> handle = backend->compile(f, true);
+    const size_t calls = 5;
+    for (size_t i = 0; i < calls; i++)
+    {
+        handle->call_with_validate({result}, {a, b});
+    }
+
+    bool found_dot = false;
+    for (const runtime::PerformanceCounter& p : handle->get_performance_data())
+    {
+        EXPECT_EQ(p.call_count(), calls);
+        EXPECT_EQ(p.get_latency_histogram().get_count(), calls);
+        EXPECT_LE(p.p50_microseconds(), p.p99_microseconds());
+        if (is_type<op::Dot>(p.get_node()))
+        {
+            found_dot = true;
+            EXPECT_EQ(p.bytes_read(), (32 + 16) * sizeof(float));
+            EXPECT_EQ(p.bytes_written(), 8 * sizeof(float));
+            EXPECT_EQ(p.flops(), 2 * 8 * 8);
+        }
+        else if (is_type<op::Add>(p.get_node()))
+        {
+            EXPECT_EQ(p.flops(), 8);
+        }
+    }
+    EXPECT_TRUE(found_dot);
+    EXPECT_EQ(handle->get_call_performance_data().call_count(), calls);
+    EXPECT_EQ(handle->get_call_performance_data().get_node(), nullptr);
+}
+
+TEST(INTERPRETER, latency_histogram)
+{
+    runtime::LatencyHistogram h;
+    EXPECT_EQ(h.get_percentile(50), 0);
+    for (int64_t i = 1; i <= 1000; i++)
+    {
+        h.add(chrono::nanoseconds(i * 1000));
+    }
+    EXPECT_EQ(h.get_count(), 1000);
+    EXPECT_NEAR(h.get_percentile(50), 500000, 500000 * 0.04);
+    EXPECT_NEAR(h.get_percentile(99), 990000, 990000 * 0.04);
+    EXPECT_NEAR(h.get_percentile(100), 1000000, 1000000 * 0.04);
+}
+
+TEST(INTERPRETER, concurrent_performance_counter)
+{
+    runtime::ConcurrentPerformanceCounter counter;
+    vector<thread> threads;
+    for (int64_t t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&counter]() {
+            for (int64_t i = 1; i <= 1000; i++)
+            {
+                counter.add_call(chrono::nanoseconds(i * 1000));
+            }
+            counter.add_untimed_call();
+        });
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+
+    runtime::PerformanceCounter snapshot = counter.get_counter(nullptr);
+    EXPECT_EQ(snapshot.call_count(), 4004);
+    EXPECT_EQ(snapshot.get_latency_histogram().get_count(), 4000);
+    EXPECT_EQ(snapshot.total_microseconds(), 4 * 500500);
+    EXPECT_NEAR(snapshot.p50_microseconds(), 500, 500 * 0.04);
+    EXPECT_NEAR(snapshot.p99_microseconds(), 990, 990 * 0.04);
+}
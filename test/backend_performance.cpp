@@ -26,9 +26,16 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/op/interpolate.hpp"
+#include "ngraph/op/non_max_suppression.hpp"
+#include "ngraph/op/roi_align.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
+#include "util/all_close.hpp"
 #include "util/random.hpp"
 #include "util/test_tools.hpp"
 
@@ -141,3 +148,261 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Benchmarks LayerNorm over BERT-base and BERT-large hidden sizes on CPU, comparing the native
+// kernel with the decomposed graph it replaces.
+//
+TEST(benchmark, layer_norm_bert)
+{
+    const size_t tokens = 8 * 128;
+    const int n_runs = 100;
+
+    for (size_t hidden : {768, 1024})
+    {
+        Shape shape{tokens, hidden};
+        auto make_function = [&](bool decompose) {
+            auto data = make_shared<op::Parameter>(element::f32, shape);
+            auto scale = make_shared<op::Parameter>(element::f32, Shape{hidden});
+            auto bias = make_shared<op::Parameter>(element::f32, Shape{hidden});
+            auto ln = make_shared<op::LayerNorm>(data, scale, bias, false, 1);
+            NodeVector results{ln};
+            if (decompose)
+            {
+                results = ln->decompose_op();
+            }
+            return make_shared<Function>(results, ParameterVector{data, scale, bias});
+        };
+
+        auto backend = runtime::Backend::create("CPU");
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (const Shape& input_shape : {shape, Shape{hidden}, Shape{hidden}})
+        {
+            vector<float> values(shape_size(input_shape));
+            rng.initialize(values);
+            auto tensor = backend->create_tensor(element::f32, input_shape);
+            copy_data(tensor, values);
+            inputs.push_back(tensor);
+        }
+
+        vector<vector<float>> results;
+        for (bool decompose : {false, true})
+        {
+            auto handle = backend->compile(make_function(decompose));
+            auto result = backend->create_tensor(element::f32, shape);
+            handle->call_with_validate({result}, inputs);
+
+            stopwatch sw;
+            sw.start();
+            for (int i = 0; i < n_runs; i++)
+            {
+                handle->call({result}, inputs);
+            }
+            sw.stop();
+            std::cout << "LayerNorm " << shape << (decompose ? " decomposed: " : " native: ")
+                      << (sw.get_microseconds() / n_runs) << " us/call" << std::endl;
+            results.push_back(read_vector<float>(result));
+        }
+        EXPECT_TRUE(test::all_close(results[0], results[1], 1.0e-4f, 1.0e-4f));
+    }
+}
+
+//
+// Benchmarks NonMaxSuppression at SSD post-processing sizes on INTERPRETER and CPU, and the
+// soft-NMS variant of the reference kernel, which the op itself does not expose.
+//
+TEST(benchmark, non_max_suppression_ssd)
+{
+    const size_t num_boxes = 8732;
+    const size_t classes = 90;
+    const int64_t max_boxes = 100;
+    const float iou_threshold = 0.5f;
+    const float score_threshold = 0.05f;
+    const int n_runs = 10;
+
+    Shape boxes_shape{1, num_boxes, 4};
+    Shape scores_shape{1, classes, num_boxes};
+    vector<float> boxes(shape_size(boxes_shape));
+    vector<float> scores(shape_size(scores_shape));
+    test::Uniform<float> rng(0.0f, 1.0f);
+    rng.initialize(boxes);
+    rng.initialize(scores);
+
+    auto boxes_param = make_shared<op::Parameter>(element::f32, boxes_shape);
+    auto scores_param = make_shared<op::Parameter>(element::f32, scores_shape);
+    auto nms = make_shared<op::v1::NonMaxSuppression>(
+        boxes_param,
+        scores_param,
+        op::Constant::create(element::i64, Shape{}, {max_boxes}),
+        op::Constant::create(element::f32, Shape{}, {iou_threshold}),
+        op::Constant::create(element::f32, Shape{}, {score_threshold}),
+        op::v1::NonMaxSuppression::BoxEncodingType::CORNER,
+        true);
+    auto f = make_shared<Function>(nms, ParameterVector{boxes_param, scores_param});
+
+    vector<vector<int64_t>> results;
+    for (const string& backend_name : {"INTERPRETER", "CPU"})
+    {
+        auto backend = runtime::Backend::create(backend_name);
+        auto boxes_tensor = backend->create_tensor(element::f32, boxes_shape);
+        copy_data(boxes_tensor, boxes);
+        auto scores_tensor = backend->create_tensor(element::f32, scores_shape);
+        copy_data(scores_tensor, scores);
+        auto result = backend->create_tensor(element::i64, f->get_output_shape(0));
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {boxes_tensor, scores_tensor});
+
+        stopwatch sw;
+        sw.start();
+        for (int i = 0; i < n_runs; i++)
+        {
+            handle->call({result}, {boxes_tensor, scores_tensor});
+        }
+        sw.stop();
+        std::cout << "NonMaxSuppression " << scores_shape << " " << backend_name << ": "
+                  << (sw.get_microseconds() / n_runs) << " us/call" << std::endl;
+        results.push_back(read_vector<int64_t>(result));
+    }
+    EXPECT_EQ(results[0], results[1]);
+
+    runtime::reference::NMSParameters params;
+    params.max_selected = max_boxes;
+    params.iou_threshold = iou_threshold;
+    params.score_threshold = score_threshold;
+    vector<int64_t> output(3 * max_boxes * classes);
+    for (float sigma : {0.0f, 0.5f})
+    {
+        params.soft_nms_sigma = sigma;
+        stopwatch sw;
+        sw.start();
+        for (int i = 0; i < n_runs; i++)
+        {
+            runtime::reference::non_max_suppression(boxes.data(),
+                                                    scores.data(),
+                                                    scores_shape,
+                                                    params,
+                                                    true,
+                                                    output.data(),
+                                                    max_boxes * classes);
+        }
+        sw.stop();
+        std::cout << "reference non_max_suppression " << scores_shape << " soft_nms_sigma "
+                  << sigma << ": " << (sw.get_microseconds() / n_runs) << " us/call"
+                  << std::endl;
+    }
+}
+
+// Times f on INTERPRETER and CPU with the given f32 inputs and returns each backend's output
+static vector<vector<float>> time_on_backends(const string& label,
+                                              const shared_ptr<Function>& f,
+                                              const vector<vector<float>>& input_values,
+                                              int n_runs)
+{
+    vector<vector<float>> results;
+    for (const string& backend_name : {"INTERPRETER", "CPU"})
+    {
+        auto backend = runtime::Backend::create(backend_name);
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (size_t i = 0; i < input_values.size(); i++)
+        {
+            auto tensor =
+                backend->create_tensor(element::f32, f->get_parameters()[i]->get_shape());
+            copy_data(tensor, input_values[i]);
+            inputs.push_back(tensor);
+        }
+        auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, inputs);
+
+        stopwatch sw;
+        sw.start();
+        for (int i = 0; i < n_runs; i++)
+        {
+            handle->call({result}, inputs);
+        }
+        sw.stop();
+        std::cout << label << " " << backend_name << ": " << (sw.get_microseconds() / n_runs)
+                  << " us/call" << std::endl;
+        results.push_back(read_vector<float>(result));
+    }
+    return results;
+}
+
+//
+// Benchmarks Interpolate resizing a 720p RGB frame down to a 224x224 network input and back
+// up, in nearest and linear modes.
+//
+TEST(benchmark, interpolate_resize)
+{
+    const int n_runs = 10;
+    test::Uniform<float> rng(0.0f, 255.0f);
+
+    for (const string& mode : {"nearest", "linear"})
+    {
+        for (auto sizes : {make_pair(Shape{1, 3, 720, 1280}, Shape{224, 224}),
+                           make_pair(Shape{1, 3, 224, 224}, Shape{720, 1280})})
+        {
+            const Shape& image_shape = sizes.first;
+            const Shape& spatial_shape = sizes.second;
+            op::InterpolateAttrs attrs;
+            attrs.axes = AxisSet{2, 3};
+            attrs.mode = mode;
+            attrs.align_corners = false;
+            auto image = make_shared<op::Parameter>(element::f32, image_shape);
+            auto output_shape = op::Constant::create(element::i64, Shape{2}, spatial_shape);
+            auto interpolate = make_shared<op::Interpolate>(image, output_shape, attrs);
+            auto f = make_shared<Function>(interpolate, ParameterVector{image});
+
+            vector<float> image_values(shape_size(image_shape));
+            rng.initialize(image_values);
+            stringstream label;
+            label << "Interpolate " << mode << " " << image_shape << " to " << spatial_shape;
+            auto results = time_on_backends(label.str(), f, {image_values}, n_runs);
+            EXPECT_TRUE(test::all_close(results[0], results[1], 1.0e-4f, 1.0e-4f));
+        }
+    }
+}
+
+//
+// Benchmarks ROIAlign at Mask R-CNN head sizes: 1000 ROIs pooled to 7x7 for the box head and
+// to 14x14 for the mask head from a 256-channel feature map.
+//
+TEST(benchmark, roi_align_mask_rcnn)
+{
+    const size_t num_rois = 1000;
+    const int n_runs = 5;
+    Shape data_shape{1, 256, 200, 272};
+
+    vector<float> data_values(shape_size(data_shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(data_values);
+    vector<float> corners(2 * num_rois);
+    test::Uniform<float>(0.0f, 180.0f).initialize(corners);
+    vector<float> sizes(2 * num_rois);
+    test::Uniform<float>(4.0f, 90.0f).initialize(sizes);
+    vector<float> rois_values;
+    for (size_t i = 0; i < num_rois; i++)
+    {
+        float x = corners[2 * i];
+        float y = corners[2 * i + 1];
+        rois_values.insert(rois_values.end(), {x, y, x + sizes[2 * i], y + sizes[2 * i + 1]});
+    }
+
+    for (int pooled : {7, 14})
+    {
+        auto data = make_shared<op::Parameter>(element::f32, data_shape);
+        auto rois = make_shared<op::Parameter>(element::f32, Shape{num_rois, 4});
+        auto batch_indices = op::Constant::create(
+            element::i64, Shape{num_rois}, vector<int64_t>(num_rois, 0));
+        auto roi_align = make_shared<op::v3::ROIAlign>(
+            data, rois, batch_indices, pooled, pooled, 2, 1.0f, "avg");
+        auto f = make_shared<Function>(roi_align, ParameterVector{data, rois});
+
+        stringstream label;
+        label << "ROIAlign " << data_shape << " " << num_rois << " ROIs to " << pooled << "x"
+              << pooled;
+        auto results = time_on_backends(label.str(), f, {data_values, rois_values}, n_runs);
+        EXPECT_TRUE(test::all_close(results[0], results[1], 1.0e-5f, 1.0e-5f));
+    }
+}
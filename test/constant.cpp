@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "util/type_prop.hpp"
 
 using namespace ngraph;
@@ -1389,3 +1390,22 @@ TEST(constant, bad_get_data_ptr)
         EXPECT_HAS_SUBSTRING(error.what(), std::string("get_data_ptr"));
     }
 }
+
+TEST(constant, shared_buffer)
+{
+    auto values = make_shared<vector<float>>(vector<float>{1, 2, 3, 4, 5, 6});
+    auto buffer = make_shared<runtime::SharedBuffer<shared_ptr<vector<float>>>>(
+        reinterpret_cast<char*>(values->data()), values->size() * sizeof(float), values);
+    const float* data = values->data();
+    values.reset();
+
+    op::Constant c(element::f32, Shape{2, 3}, buffer);
+    EXPECT_EQ(c.get_data_ptr(), data);
+    EXPECT_EQ(c.get_vector<float>(), (vector<float>{1, 2, 3, 4, 5, 6}));
+
+    // Copies keep referencing the same memory
+    op::Constant copy(c);
+    EXPECT_EQ(copy.get_data_ptr(), data);
+
+    EXPECT_ANY_THROW(op::Constant(element::f32, Shape{2, 4}, buffer));
+}
@@ -3128,3 +3128,98 @@ TEST(constant_folding, constant_dyn_reshape_v1_pattern_with_zero_dims)
     test_constant_folding_reshape_v1(shape_in, values_in, {4}, {2, -1, 2, 0}, true);
     test_constant_folding_reshape_v1(shape_in, values_in, {4}, {4, 1, 0, 2}, true);
 }
+
+TEST(constant_folding, cost_model_expansion_ratio)
+{
+    auto make_function = []() {
+        auto scalar = op::Constant::create(element::f32, Shape{}, {3});
+        auto broadcast = make_shared<op::Broadcast>(scalar, Shape{256, 256}, AxisSet{0, 1});
+        auto small = make_shared<op::Broadcast>(scalar, Shape{4}, AxisSet{0});
+        return make_shared<Function>(NodeVector{broadcast, small}, ParameterVector{});
+    };
+
+    pass::ConstantFolding::CostModel cost_model;
+    cost_model.max_expansion_ratio = 16;
+    auto f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(BuildNodeExecutorMap(), cost_model);
+    pass_manager.run_passes(f);
+
+    // The large broadcast stays for run time; the small one is under min_checked_bytes
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+    ASSERT_TRUE(is_type<op::Broadcast>(f->get_results().at(0)->get_argument(0)));
+    ASSERT_EQ(get_result_constant<float>(f, 1), (vector<float>{3, 3, 3, 3}));
+
+    cost_model.max_expansion_ratio = 0;
+    f = make_function();
+    pass::Manager unlimited_pass_manager;
+    unlimited_pass_manager.register_pass<pass::ConstantFolding>(BuildNodeExecutorMap(),
+                                                                cost_model);
+    unlimited_pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+}
+
+TEST(constant_folding, cost_model_memory_budget)
+{
+    for (bool parallel : {false, true})
+    {
+        NodeVector results;
+        for (int i = 0; i < 16; i++)
+        {
+            auto c = op::Constant::create(element::f32, Shape{1024}, vector<float>(1024, i));
+            results.push_back(make_shared<op::Negative>(c));
+        }
+        auto f = make_shared<Function>(results, ParameterVector{});
+
+        pass::ConstantFolding::CostModel cost_model;
+        cost_model.memory_budget = 2 * 1024 * sizeof(float);
+        auto constant_folding =
+            make_shared<pass::ConstantFolding>(BuildNodeExecutorMap(), cost_model);
+        constant_folding->set_parallel(parallel);
+        constant_folding->run_on_function(f);
+
+        ASSERT_EQ(count_ops_of_type<op::Negative>(f), 14) << "parallel: " << parallel;
+    }
+}
+
+TEST(constant_folding, parallel)
+{
+    // Independent subgraphs two levels deep, plus one that spans a parameter
+    auto make_function = []() {
+        NodeVector results;
+        for (int i = 0; i < 8; i++)
+        {
+            auto a = op::Constant::create(element::i32, Shape{2, 2}, {i, i + 1, i + 2, i + 3});
+            auto b = op::Constant::create(element::i32, Shape{2, 2}, {1, 2, 3, 4});
+            auto sum = make_shared<op::Sum>(make_shared<op::Multiply>(a, b), AxisSet{1});
+            results.push_back(make_shared<op::Negative>(sum));
+        }
+        auto p = make_shared<op::Parameter>(element::i32, Shape{2});
+        auto c = op::Constant::create(element::i32, Shape{2}, {5, 6});
+        results.push_back(make_shared<op::Add>(p, make_shared<op::Negative>(c)));
+        return make_shared<Function>(results, ParameterVector{p});
+    };
+
+    auto serial = make_function();
+    auto serial_folding = make_shared<pass::ConstantFolding>();
+    serial_folding->set_parallel(false);
+    serial_folding->run_on_function(serial);
+    ASSERT_EQ(count_ops_of_type<op::Negative>(serial), 0);
+
+    auto parallel = make_function();
+    auto parallel_folding = make_shared<pass::ConstantFolding>();
+    parallel_folding->set_parallel(true);
+    ASSERT_TRUE(parallel_folding->run_on_function(parallel));
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(parallel), 0);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(parallel), 0);
+    ASSERT_EQ(count_ops_of_type<op::Add>(parallel), 1);
+    for (size_t i = 0; i < 8; i++)
+    {
+        ASSERT_EQ(get_result_constant<int32_t>(parallel, i),
+                  get_result_constant<int32_t>(serial, i));
+    }
+    auto add = parallel->get_results().at(8)->get_argument(0);
+    ASSERT_EQ(as_type_ptr<op::Constant>(add->get_argument(1))->get_vector<int32_t>(),
+              (vector<int32_t>{-5, -6}));
+}
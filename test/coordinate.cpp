@@ -20,6 +20,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/strided_offset_iterator.hpp"
 #include "util/ndarray.hpp"
 #include "util/test_tools.hpp"
 
@@ -335,3 +336,110 @@ TEST(benchmark, coordinate)
     timer.stop();
     cout << "time: " << timer.get_milliseconds() << endl;
 }
+
+TEST(strided_offset_iterator, dense)
+{
+    Shape shape{2, 3};
+    StridedOffsetIterator it(shape, StridedOffsetIterator::row_major_strides(shape));
+    // Both axes are contiguous, so the whole tensor is a single run
+    ASSERT_FALSE(it.done());
+    EXPECT_EQ(it.source_offset(), 0);
+    EXPECT_EQ(it.target_offset(), 0);
+    EXPECT_EQ(it.run_size(), 6);
+    EXPECT_EQ(it.source_run_stride(), 1);
+    it.next_run();
+    EXPECT_TRUE(it.done());
+}
+
+TEST(strided_offset_iterator, transpose)
+{
+    // Walk a {2, 3} tensor in column-major order
+    StridedOffsetIterator it(Shape{3, 2}, {1, 3});
+    vector<ptrdiff_t> source;
+    vector<ptrdiff_t> target;
+    for (; !it.done(); it.next_run())
+    {
+        for (size_t i = 0; i < it.run_size(); i++)
+        {
+            source.push_back(it.source_offset() + i * it.source_run_stride());
+            target.push_back(it.target_offset() + i * it.target_run_stride());
+        }
+    }
+    EXPECT_EQ(source, (vector<ptrdiff_t>{0, 3, 1, 4, 2, 5}));
+    EXPECT_EQ(target, (vector<ptrdiff_t>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST(strided_offset_iterator, reverse_and_broadcast)
+{
+    // Axis 0 is broadcast, axis 1 is reversed, unit axis 2 is dropped
+    StridedOffsetIterator it(Shape{2, 3, 1}, {0, -1, 7}, 2);
+    vector<ptrdiff_t> source;
+    for (; !it.done(); it.next_run())
+    {
+        for (size_t i = 0; i < it.run_size(); i++)
+        {
+            source.push_back(it.source_offset() + i * it.source_run_stride());
+        }
+    }
+    EXPECT_EQ(source, (vector<ptrdiff_t>{2, 1, 0, 2, 1, 0}));
+}
+
+TEST(strided_offset_iterator, empty_and_scalar)
+{
+    EXPECT_TRUE(StridedOffsetIterator(Shape{3, 0, 2}, {0, 2, 1}).done());
+
+    StridedOffsetIterator scalar(Shape{}, {}, 5);
+    ASSERT_FALSE(scalar.done());
+    EXPECT_EQ(scalar.source_offset(), 5);
+    EXPECT_EQ(scalar.run_size(), 1);
+    scalar.next_run();
+    EXPECT_TRUE(scalar.done());
+}
+
+TEST(benchmark, strided_offset_iterator_vs_coordinate_transform)
+{
+    // NCHW -> NHWC transpose, the access pattern of reshape with a permuted axis order
+    Shape source_shape{8, 64, 56, 56};
+    AxisVector axis_order{0, 2, 3, 1};
+    Shape walk_shape{8, 56, 56, 64};
+    vector<float> source(shape_size(source_shape));
+    iota(source.begin(), source.end(), 0.0f);
+    vector<float> out_transform(source.size());
+    vector<float> out_strided(source.size());
+
+    stopwatch timer;
+    timer.start();
+    CoordinateTransform ct(source_shape,
+                           Coordinate(source_shape.size(), 0),
+                           source_shape,
+                           Strides(source_shape.size(), 1),
+                           axis_order);
+    size_t out_index = 0;
+    for (const Coordinate& c : ct)
+    {
+        out_transform[out_index++] = source[ct.index(c)];
+    }
+    timer.stop();
+    cout << "CoordinateTransform time: " << timer.get_milliseconds() << endl;
+
+    timer.start();
+    vector<ptrdiff_t> source_strides = StridedOffsetIterator::row_major_strides(source_shape);
+    vector<ptrdiff_t> walk_strides;
+    for (size_t axis : axis_order)
+    {
+        walk_strides.push_back(source_strides[axis]);
+    }
+    for (StridedOffsetIterator it(walk_shape, walk_strides); !it.done(); it.next_run())
+    {
+        const float* src = source.data() + it.source_offset();
+        float* dst = out_strided.data() + it.target_offset();
+        for (size_t i = 0; i < it.run_size(); i++)
+        {
+            dst[i] = src[i * it.source_run_stride()];
+        }
+    }
+    timer.stop();
+    cout << "StridedOffsetIterator time: " << timer.get_milliseconds() << endl;
+
+    EXPECT_EQ(out_transform, out_strided);
+}
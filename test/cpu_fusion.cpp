@@ -68,6 +68,7 @@
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
@@ -77,6 +78,7 @@
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
@@ -3942,3 +3944,57 @@ TEST(cpu_fusion, mlir_matmul_bias)
 }
 
 #endif
+
+// (x * a + b).tanh() * c with a a scalar, b broadcast along rows and c along columns
+static shared_ptr<Function> gen_elementwise_chain()
+{
+    Shape shape{3, 1000};
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto a = make_shared<op::Parameter>(element::f32, Shape{});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto c = make_shared<op::Parameter>(element::f32, Shape{1000});
+    auto xa = make_shared<op::Multiply>(x, make_shared<op::Broadcast>(a, shape, AxisSet{0, 1}));
+    auto xab = make_shared<op::Add>(xa, make_shared<op::Broadcast>(b, shape, AxisSet{1}));
+    auto result = make_shared<op::Multiply>(make_shared<op::Tanh>(xab),
+                                            make_shared<op::Broadcast>(c, shape, AxisSet{0}));
+    return make_shared<Function>(NodeVector{result}, ParameterVector{x, a, b, c});
+}
+
+TEST(cpu_fusion, fuse_elementwise_chain)
+{
+    auto func = gen_elementwise_chain();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::Tanh>(func), 0);
+
+    // An intermediate with a user outside of the chain ends a chain of its own
+    auto x = make_shared<op::Parameter>(element::f32, Shape{8});
+    auto t = make_shared<op::Tanh>(make_shared<op::Exp>(x));
+    auto u = make_shared<op::Multiply>(make_shared<op::Add>(t, x), x);
+    auto func_split = make_shared<Function>(NodeVector{u, t}, ParameterVector{x});
+    pass_manager.run_passes(func_split);
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(func_split), 2);
+}
+
+TEST(cpu_fusion, elementwise_chain_cpu_vs_inter)
+{
+    auto int_func = gen_elementwise_chain();
+    auto cpu_func = gen_elementwise_chain();
+
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_func->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_func, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_func, args, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::FusedElementwise>(cpu_func), 1);
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
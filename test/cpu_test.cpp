@@ -19,11 +19,13 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <set>
 #include <thread>
 
 #include "gtest/gtest.h"
 #include "misc.hpp"
 #include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/cpio.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
@@ -40,6 +42,9 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
@@ -54,6 +59,7 @@
 #include "util/ndarray.hpp"
 #include "util/random.hpp"
 #include "util/test_tools.hpp"
+#include "util/type_prop.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -1052,6 +1058,186 @@ TEST(cpu_test, thread_safe_calls_convolution_2d_2items)
     unset_environment("NGRAPH_CPU_CONCURRENCY");
 }
 
+TEST(cpu_test, thread_safe_calls_concurrent_contexts)
+{
+    if (is_codegen_mode())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "4", 1);
+
+    // relu(A) is cacheable, so calls reuse it on every context that already computed it
+    Shape shape{2, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape, true);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Relu>(A) * B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    auto cf = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)->get_call_frame();
+    ASSERT_EQ(cf->get_concurrency(), 4);
+
+    vector<float> a_data{1, -2, 3, -4, 5, -6, 7, -8};
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, a_data);
+    {
+        auto b = backend->create_tensor(element::f32, shape);
+        copy_data(b, vector<float>(8, 1));
+        auto result = backend->create_tensor(element::f32, shape);
+        handle->call_with_validate({result}, {a, b});
+    }
+    a->set_stale(false);
+
+    const size_t num_threads = 8;
+    const size_t num_calls = 50;
+    auto make_calls = [&](size_t thread) {
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        for (size_t call = 0; call < num_calls; call++)
+        {
+            float scale = static_cast<float>(thread * num_calls + call);
+            copy_data(b, vector<float>(8, scale));
+            vector<float> expected;
+            for (float value : a_data)
+            {
+                expected.push_back(max(value, 0.0f) * scale);
+            }
+
+            handle->call({result}, {a, b});
+
+            EXPECT_EQ(expected, read_vector<float>(result));
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        threads.emplace_back(make_calls, i);
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+TEST(cpu_test, stale_input_recomputed_on_other_context)
+{
+    if (is_codegen_mode())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape, true);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Relu>(A) + B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    auto cf = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)->get_call_frame();
+    ASSERT_EQ(cf->get_concurrency(), 2);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{10, 10, 10, 10});
+
+    // Context 0 caches relu(A) for the first value of A
+    copy_data(a, vector<float>{1, -1, 2, -2});
+    cf->call_on_context({result}, {a, b}, 0);
+    EXPECT_EQ((vector<float>{11, 10, 12, 10}), read_vector<float>(result));
+
+    // A changes and is flagged stale on a call that runs on context 1
+    copy_data(a, vector<float>{-3, 3, -4, 4});
+    a->set_stale(true);
+    cf->call_on_context({result}, {a, b}, 1);
+    EXPECT_EQ((vector<float>{10, 13, 10, 14}), read_vector<float>(result));
+
+    // The hint is clear now, but context 0 has not seen the change and must recompute
+    a->set_stale(false);
+    cf->call_on_context({result}, {a, b}, 0);
+    EXPECT_EQ((vector<float>{10, 13, 10, 14}), read_vector<float>(result));
+
+    // Both contexts are up to date, so they may reuse their cached relu(A)
+    copy_data(b, vector<float>{20, 20, 20, 20});
+    cf->call_on_context({result}, {a, b}, 1);
+    EXPECT_EQ((vector<float>{20, 23, 20, 24}), read_vector<float>(result));
+    cf->call_on_context({result}, {a, b}, 0);
+    EXPECT_EQ((vector<float>{20, 23, 20, 24}), read_vector<float>(result));
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+TEST(cpu_test, contexts_spread_over_executor_pools)
+{
+    if (is_codegen_mode())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "4", 1);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    auto cf = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)->get_call_frame();
+
+    int num_pools = runtime::cpu::executor::GetCPUExecutor().get_num_thread_pools();
+    ASSERT_EQ(cf->get_concurrency(), 4);
+    for (size_t i = 0; i < cf->get_concurrency(); i++)
+    {
+        EXPECT_EQ(cf->get_context_pool(i), static_cast<int>(i % num_pools));
+    }
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+TEST(cpu_test, executor_pinned_pools_first_touch)
+{
+    // Two pools pinned to core 0, which every machine has
+    set_environment("NGRAPH_CPU_POOL_CORES", "0;0", 1);
+    runtime::cpu::executor::CPUExecutor executor(1);
+    unset_environment("NGRAPH_CPU_POOL_CORES");
+
+    ASSERT_EQ(executor.get_num_thread_pools(), 2);
+    EXPECT_EQ(executor.get_pool_cores(0), vector<int>{0});
+    EXPECT_EQ(executor.get_pool_cores(1), vector<int>{0});
+
+    vector<char> buffer(4096, 1);
+    executor.first_touch(1, buffer.data(), buffer.size());
+    EXPECT_EQ(buffer, vector<char>(4096, 0));
+}
+
+TEST(cpu_test, executor_unpinned_first_touch_is_noop)
+{
+    unset_environment("NGRAPH_CPU_POOL_CORES");
+    unset_environment("NGRAPH_CPU_NUMA_POOLS");
+    runtime::cpu::executor::CPUExecutor executor(2);
+
+    ASSERT_EQ(executor.get_num_thread_pools(), 2);
+    EXPECT_TRUE(executor.get_pool_cores(0).empty());
+    EXPECT_TRUE(executor.get_pool_cores(1).empty());
+
+    vector<char> buffer(4096, 1);
+    executor.first_touch(1, buffer.data(), buffer.size());
+    EXPECT_EQ(buffer, vector<char>(4096, 1));
+}
+
 // This test checks if a ConverLayout node is inserted before the ConvolutionBias node.
 // Since MLIR supports ConvolutionBias through callback, the data layout conversion is done in
 // callback.
@@ -2221,6 +2407,95 @@ TEST(cpu_test, MLIR_DISABLE_TEST(convolution_simple_bf16))
               read_vector<bfloat16>(result));
 }
 
+TEST(cpu_test, MLIR_DISABLE_TEST(embeddingbag_offsets_sum_bf16))
+{
+    if (!runtime::cpu::mkldnn_utils::is_bf16_supported())
+    {
+        NGRAPH_WARN << "This test is skipped for platform without bf16 support.";
+        return;
+    }
+
+    Shape shape_table{5, 2};
+    auto table = make_shared<op::Parameter>(element::f32, shape_table);
+    auto table_bf16 = make_shared<op::Convert>(table, element::bf16);
+    auto indices = op::Constant::create(element::i64, Shape{4}, {0, 2, 3, 4});
+    auto offsets = op::Constant::create(element::i64, Shape{2}, {0, 2});
+    auto embedding_bag = make_shared<op::v3::EmbeddingBagOffsetsSum>(table_bf16, indices, offsets);
+    auto f = make_shared<Function>(embedding_bag, ParameterVector{table});
+
+    auto backend = runtime::Backend::create("CPU");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape_table);
+    copy_data(a, vector<float>{0, 1, 10, 11, 20, 21, 30, 31, 40, 41});
+    auto result = backend->create_tensor(element::bf16, Shape{2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<bfloat16>{20.0, 22.0, 70.0, 72.0}), read_vector<bfloat16>(result));
+}
+
+TEST(cpu_test, MLIR_DISABLE_TEST(embeddingbag_offsets_sum_bf16_long_bag))
+{
+    if (!runtime::cpu::mkldnn_utils::is_bf16_supported())
+    {
+        NGRAPH_WARN << "This test is skipped for platform without bf16 support.";
+        return;
+    }
+
+    // 256 + 1 rounds back to 256 in bf16, so the bag only reaches 512 when the rows are
+    // accumulated in float
+    Shape shape_table{2, 1};
+    auto table = make_shared<op::Parameter>(element::f32, shape_table);
+    auto table_bf16 = make_shared<op::Convert>(table, element::bf16);
+    vector<int64_t> index_values(257, 1);
+    index_values[0] = 0;
+    auto indices = op::Constant::create(element::i64, Shape{257}, index_values);
+    auto offsets = op::Constant::create(element::i64, Shape{1}, {0});
+    auto embedding_bag = make_shared<op::v3::EmbeddingBagOffsetsSum>(table_bf16, indices, offsets);
+    auto f = make_shared<Function>(embedding_bag, ParameterVector{table});
+
+    auto backend = runtime::Backend::create("CPU");
+
+    auto a = backend->create_tensor(element::f32, shape_table);
+    copy_data(a, vector<float>{256, 1});
+    auto result = backend->create_tensor(element::bf16, Shape{1, 1});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<bfloat16>{512.0}), read_vector<bfloat16>(result));
+}
+
+TEST(cpu_test, MLIR_DISABLE_TEST(embedding_segments_sum_bf16))
+{
+    if (!runtime::cpu::mkldnn_utils::is_bf16_supported())
+    {
+        NGRAPH_WARN << "This test is skipped for platform without bf16 support.";
+        return;
+    }
+
+    Shape shape_table{5, 2};
+    auto table = make_shared<op::Parameter>(element::f32, shape_table);
+    auto table_bf16 = make_shared<op::Convert>(table, element::bf16);
+    auto indices = op::Constant::create(element::i64, Shape{4}, {0, 2, 3, 4});
+    auto segment_ids = op::Constant::create(element::i64, Shape{4}, {0, 0, 1, 1});
+    auto num_segments = op::Constant::create(element::i64, Shape{}, {2});
+    auto embedding_segments =
+        make_shared<op::v3::EmbeddingSegmentsSum>(table_bf16, indices, segment_ids, num_segments);
+    auto f = make_shared<Function>(embedding_segments, ParameterVector{table});
+
+    auto backend = runtime::Backend::create("CPU");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape_table);
+    copy_data(a, vector<float>{0, 1, 10, 11, 20, 21, 30, 31, 40, 41});
+    auto result = backend->create_tensor(element::bf16, Shape{2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<bfloat16>{20.0, 22.0, 70.0, 72.0}), read_vector<bfloat16>(result));
+}
+
 // This tests a backend's implementation of the three parameter version of create_tensor
 // Testing using this tensor as a Function input
 TEST(cpu_test, create_tensor_2_input)
@@ -2325,3 +2600,204 @@ TEST(cpu_test, one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+#ifndef NGRAPH_JSON_DISABLE
+TEST(cpu_test, save_load)
+{
+    // Convolution + bias + relu is rewritten by the CPU fusion and layout passes, so this checks
+    // that the loaded function is not rewritten a second time
+    Shape data_shape{1, 2, 5, 5};
+    Shape filter_shape{3, 2, 3, 3};
+    auto data = make_shared<op::Parameter>(element::f32, data_shape);
+    auto filters = op::Constant::create(element::f32, filter_shape, vector<float>(54, 0.5f));
+    auto bias = op::Constant::create(element::f32, Shape{3}, {1.f, 2.f, 3.f});
+    auto conv = make_shared<op::Convolution>(data, filters);
+    auto conv_bias = make_shared<op::Add>(
+        conv, make_shared<op::Broadcast>(bias, conv->get_shape(), AxisSet{0, 2, 3}));
+    auto f = make_shared<Function>(make_shared<op::Relu>(conv_bias), ParameterVector{data});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, data_shape);
+    copy_data(a, vector<float>(50, 1.0f));
+    auto expected = backend->create_tensor(element::f32, Shape{1, 3, 3, 3});
+    auto result = backend->create_tensor(element::f32, Shape{1, 3, 3, 3});
+
+    stringstream file;
+    {
+        ngraph::pass::PassConfig pass_config;
+        pass_config.set_pass_attribute("ReuseMemory", true);
+        pass_config.set_pass_attribute("CPU_Executable::Save", true);
+        auto handle = backend->compile(f, pass_config);
+        handle->call_with_validate({expected}, {a});
+        handle->save(file);
+    }
+    {
+        // A fresh backend, so the structural compile cache cannot hand back the first handle
+        auto load_backend = runtime::Backend::create("CPU");
+        auto handle = load_backend->load(file);
+        ASSERT_NE(handle, nullptr);
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(expected), read_vector<float>(result)));
+    }
+}
+#endif
+
+#ifndef NGRAPH_JSON_DISABLE
+TEST(cpu_test, save_load_optimized)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * A, ParameterVector{A, B});
+
+    // Executables only keep what save() needs when asked to
+    try
+    {
+        stringstream unused;
+        runtime::Backend::create("CPU")->compile(f)->save(unused);
+        FAIL() << "Saving without the CPU_Executable::Save pass attribute not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), string("CPU_Executable::Save pass attribute"));
+    }
+
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPU_Executable::Save", true);
+    stringstream file;
+    backend->compile(f, pass_config)->save(file);
+
+    // The optimized function and its memory plan are saved instead of the source function
+    set<string> entries;
+    {
+        stringstream copy(file.str());
+        cpio::Reader reader(copy);
+        for (const cpio::FileInfo& info : reader.get_file_info())
+        {
+            entries.insert(info.get_name());
+        }
+    }
+    EXPECT_EQ(entries.count("optimized_model"), 1);
+    EXPECT_EQ(entries.count("memory_plan"), 1);
+    EXPECT_EQ(entries.count("model"), 0);
+
+    auto load_backend = runtime::Backend::create("CPU");
+    auto handle = load_backend->load(file);
+    ASSERT_NE(handle, nullptr);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{6, 5, 4, 3, 2, 1});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(
+        test::all_close_f((vector<float>{7, 14, 21, 28, 35, 42}), read_vector<float>(result)));
+}
+#endif
+
+#ifndef NGRAPH_JSON_DISABLE
+TEST(cpu_test, save_load_rejects_stale_memory_plan)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * A, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPU_Executable::Save", true);
+    stringstream file;
+    backend->compile(f, pass_config)->save(file);
+
+    // Move every tensor past the end of the temporary pool
+    stringstream stale;
+    {
+        cpio::Reader reader(file);
+        cpio::Writer writer(stale);
+        for (const cpio::FileInfo& info : reader.get_file_info())
+        {
+            vector<char> buffer = reader.read(info);
+            string entry(buffer.data(), buffer.size());
+            if (info.get_name() == "memory_plan")
+            {
+                stringstream plan(entry);
+                stringstream rewritten;
+                string line;
+                while (getline(plan, line))
+                {
+                    stringstream fields(line);
+                    string kind;
+                    size_t op;
+                    size_t output;
+                    size_t offset;
+                    size_t size;
+                    if ((fields >> kind) && kind == "offset" &&
+                        (fields >> op >> output >> offset >> size))
+                    {
+                        line = "offset " + to_string(op) + " " + to_string(output) + " " +
+                               to_string(offset + (1 << 20)) + " " + to_string(size);
+                    }
+                    rewritten << line << "\n";
+                }
+                entry = rewritten.str();
+            }
+            writer.write(info.get_name(), entry.data(), entry.size());
+        }
+    }
+
+    // The plan is rejected and the memory pool planned again
+    auto handle = runtime::Backend::create("CPU")->load(stale);
+    ASSERT_NE(handle, nullptr);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{6, 5, 4, 3, 2, 1});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(
+        test::all_close_f((vector<float>{7, 14, 21, 28, 35, 42}), read_vector<float>(result)));
+}
+#endif
+
+#ifndef NGRAPH_JSON_DISABLE
+// Relu has no attribute visitor, so its signature relies on the serializer
+TEST(cpu_test, structural_compile_cache)
+{
+    auto make_function = [](float k) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+        auto K = op::Constant::create(element::f32, Shape{2, 2}, vector<float>(4, k));
+        return make_shared<Function>(make_shared<op::Relu>(A * K), ParameterVector{A});
+    };
+
+    // Off by default, every function gets its own executable
+    auto default_backend = runtime::Backend::create("CPU");
+    EXPECT_NE(default_backend->compile(make_function(2.0f)),
+              default_backend->compile(make_function(2.0f)));
+
+    set_environment("NGRAPH_CPU_STRUCTURAL_CACHE", "1", 1);
+    auto backend = runtime::Backend::create("CPU");
+    unset_environment("NGRAPH_CPU_STRUCTURAL_CACHE");
+    auto f = make_function(2.0f);
+    auto g = make_function(2.0f);
+    auto h = make_function(-1.0f);
+
+    auto f_handle = backend->compile(f);
+    EXPECT_EQ(backend->compile(g), f_handle);
+    EXPECT_NE(backend->compile(h), f_handle);
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("ReuseMemory", true);
+    EXPECT_NE(backend->compile(make_function(2.0f), pass_config), f_handle);
+
+    auto a = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(a, vector<float>{1, -2, 3, -4});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+    backend->compile(g)->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<float>{2, 0, 6, 0}), read_vector<float>(result));
+    backend->compile(h)->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<float>{0, 2, 0, 4}), read_vector<float>(result));
+
+    backend->remove_compiled_function(f_handle);
+    EXPECT_NE(backend->compile(make_function(2.0f)), f_handle);
+}
+#endif
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <fstream>
 #include <random>
 #include <sstream>
 #include <string>
@@ -95,3 +96,21 @@ TEST(file_util, get_temp_directory_path)
     string tmp = file_util::get_temp_directory_path();
     EXPECT_NE(0, tmp.size());
 }
+
+TEST(file_util, mapped_file)
+{
+    string path = file_util::tmp_filename(".bin");
+    {
+        ofstream out(path, ios::binary);
+        out << "mapped contents";
+    }
+    {
+        file_util::MappedFile file(path);
+        ASSERT_EQ(file.get_size(), 15);
+        EXPECT_EQ(string(file.get_data(), file.get_size()), "mapped contents");
+        // Writes stay private to the mapping
+        file.get_data()[0] = 'M';
+        EXPECT_EQ(file_util::read_file_to_string(path), "mapped contents");
+    }
+    file_util::remove_file(path);
+}
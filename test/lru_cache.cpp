@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(lru_cache, evicts_least_recently_used)
+{
+    auto f = make_shared<Function>(ResultVector{}, ParameterVector{});
+    runtime::LRUCache cache(2, 0);
+
+    cache.add_entry({1, -1}, nullptr, f);
+    cache.add_entry({2, -1}, nullptr, f);
+
+    shared_ptr<runtime::Executable> exec;
+    shared_ptr<Function> func;
+    // Touch {1} so that {2} becomes the least recently used entry
+    EXPECT_TRUE(cache.lookup({1, -1}, exec, func));
+    cache.add_entry({3, -1}, nullptr, f);
+
+    EXPECT_TRUE(cache.is_cached({1, -1}));
+    EXPECT_FALSE(cache.is_cached({2, -1}));
+    EXPECT_TRUE(cache.is_cached({3, -1}));
+    EXPECT_FALSE(cache.lookup({2, -1}, exec, func));
+    EXPECT_EQ(cache.get_eviction_count(), 1);
+    EXPECT_EQ(cache.get_hit_count(), 1);
+    EXPECT_EQ(cache.get_miss_count(), 1);
+    EXPECT_EQ(cache.get_entry_count(), 2);
+}
+
+TEST(lru_cache, zero_entries_disables_caching)
+{
+    auto f = make_shared<Function>(ResultVector{}, ParameterVector{});
+    runtime::LRUCache cache(0, 0);
+
+    cache.add_entry({1, -1}, nullptr, f);
+
+    shared_ptr<runtime::Executable> exec;
+    shared_ptr<Function> func;
+    EXPECT_FALSE(cache.is_cached({1, -1}));
+    EXPECT_FALSE(cache.lookup({1, -1}, exec, func));
+    EXPECT_EQ(cache.get_entry_count(), 0);
+    EXPECT_EQ(cache.get_eviction_count(), 0);
+}
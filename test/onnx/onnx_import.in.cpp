@@ -188,6 +188,18 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_add_abc_initializers)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data)
+{
+    // The initializer lives at offset 8 of tensor.bin, next to the model
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt"));
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 1, 1, 1});
+    test_case.add_expected_output<float>({2, 3, 4, 5});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_model_override_op)
 {
     onnx_import::register_operator(
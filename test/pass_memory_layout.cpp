@@ -232,3 +232,107 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+// A small temporary freed while a large one is live leaves a hole the next large one does
+// not fit in
+static shared_ptr<Function> make_fragmenting_graph()
+{
+    auto p = make_shared<op::Parameter>(element::f32, Shape{});
+    auto p2 = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto a = make_shared<op::Negative>(p);
+    auto c = make_shared<op::Broadcast>(a, Shape{4}, AxisSet{0});
+    auto b = make_shared<op::Negative>(p2);
+    auto d = make_shared<op::Add>(b, c);
+    return make_shared<Function>(make_shared<op::Negative>(d), ParameterVector{p, p2});
+}
+
+// Checks that no two temporaries live at the same op overlap in the pool
+static void check_no_overlap(const shared_ptr<Function>& f)
+{
+    struct Interval
+    {
+        const descriptor::Tensor* tensor;
+        size_t begin;
+        size_t end;
+    };
+    vector<Interval> intervals;
+    size_t step = 0;
+    for (auto node : f->get_ordered_ops())
+    {
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            intervals.push_back({tensor, step, numeric_limits<size_t>::max()});
+        }
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            for (Interval& interval : intervals)
+            {
+                if (interval.tensor == tensor)
+                {
+                    interval.end = step;
+                }
+            }
+        }
+        step++;
+    }
+    for (size_t i = 0; i < intervals.size(); i++)
+    {
+        for (size_t j = i + 1; j < intervals.size(); j++)
+        {
+            const Interval& x = intervals[i];
+            const Interval& y = intervals[j];
+            if (x.begin <= y.end && y.begin <= x.end)
+            {
+                size_t x_offset = x.tensor->get_pool_offset();
+                size_t y_offset = y.tensor->get_pool_offset();
+                EXPECT_TRUE(x_offset + x.tensor->size() <= y_offset ||
+                            y_offset + y.tensor->size() <= x_offset)
+                    << x.tensor->get_name() << " overlaps " << y.tensor->get_name();
+            }
+        }
+    }
+}
+
+TEST(memory_layout, greedy_by_size)
+{
+    auto op_order_graph = make_fragmenting_graph();
+    pass::Manager op_order_manager;
+    op_order_manager.register_pass<pass::Liveness>();
+    auto op_order = op_order_manager.register_pass<pass::MemoryLayout>(
+        1, false, pass::MemoryLayout::Planner::OP_ORDER);
+    op_order_manager.run_passes(op_order_graph);
+    check_no_overlap(op_order_graph);
+    EXPECT_EQ(op_order->get_allocated_bytes(), op_order_graph->get_temporary_pool_size());
+
+    auto greedy_graph = make_fragmenting_graph();
+    pass::Manager greedy_manager;
+    greedy_manager.register_pass<pass::Liveness>();
+    auto greedy = greedy_manager.register_pass<pass::MemoryLayout>(
+        1, false, pass::MemoryLayout::Planner::GREEDY_BY_SIZE);
+    greedy_manager.run_passes(greedy_graph);
+    check_no_overlap(greedy_graph);
+    EXPECT_EQ(greedy->get_allocated_bytes(), greedy_graph->get_temporary_pool_size());
+
+    EXPECT_EQ(greedy->get_peak_live_bytes(), op_order->get_peak_live_bytes());
+    EXPECT_GT(op_order->get_allocated_bytes(), op_order->get_peak_live_bytes());
+    EXPECT_EQ(greedy->get_allocated_bytes(), greedy->get_peak_live_bytes());
+}
+
+TEST(memory_layout, greedy_by_size_aligned)
+{
+    auto f = make_fragmenting_graph();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    auto layout = pass_manager.register_pass<pass::MemoryLayout>(
+        64, false, pass::MemoryLayout::Planner::GREEDY_BY_SIZE);
+    pass_manager.run_passes(f);
+    check_no_overlap(f);
+    for (auto node : f->get_ordered_ops())
+    {
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            EXPECT_EQ(tensor->get_pool_offset() % 64, 0);
+        }
+    }
+    EXPECT_EQ(layout->get_allocated_bytes() % 64, 0);
+}
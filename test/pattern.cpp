@@ -760,3 +760,97 @@ TEST(pattern, is_contained_match)
     ASSERT_TRUE(n.match(label_abs2, absn2));
     ASSERT_FALSE(n.is_contained_match());
 }
+
+TEST(pattern, graph_rewrite_root_type_dispatch)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(a + b) * b, ParameterVector{a, b});
+
+    vector<Node*> typed_seen;
+    size_t untyped_count = 0;
+    pass::GraphRewrite rewrite;
+    rewrite.add_handler("typed",
+                        [&](const shared_ptr<Node>& node) {
+                            typed_seen.push_back(node.get());
+                            return false;
+                        },
+                        pass::PassProperty::REQUIRE_STATIC_SHAPE,
+                        {op::Abs::type_info, op::Add::type_info});
+    rewrite.add_handler("untyped",
+                        [&](const shared_ptr<Node>&) {
+                            untyped_count++;
+                            return false;
+                        },
+                        pass::PassProperty::REQUIRE_STATIC_SHAPE);
+    EXPECT_FALSE(rewrite.run_on_function(f));
+
+    ASSERT_EQ(typed_seen.size(), 2);
+    for (Node* node : typed_seen)
+    {
+        EXPECT_TRUE(is_type<op::Abs>(node) || is_type<op::Add>(node));
+    }
+    EXPECT_EQ(untyped_count, f->get_ops().size());
+}
+
+// 0 - x is rewritten to -x, which creates a double negation that is only reachable from the
+// new node
+static void negation_rewrites(pass::GraphRewrite& rewrite)
+{
+    rewrite.add_handler("zero_minus",
+                        [](const shared_ptr<Node>& node) {
+                            auto zero = as_type_ptr<op::Constant>(
+                                node->input_value(0).get_node_shared_ptr());
+                            if (!zero || zero->get_vector<int32_t>() != vector<int32_t>{0})
+                            {
+                                return false;
+                            }
+                            replace_node(node, make_shared<op::Negative>(node->input_value(1)));
+                            return true;
+                        },
+                        pass::PassProperty::REQUIRE_STATIC_SHAPE,
+                        {op::Subtract::type_info});
+    rewrite.add_handler("double_negative",
+                        [](const shared_ptr<Node>& node) {
+                            auto arg = node->input_value(0).get_node_shared_ptr();
+                            if (!is_type<op::Negative>(arg))
+                            {
+                                return false;
+                            }
+                            replace_node(node, arg->input_value(0).get_node_shared_ptr());
+                            return true;
+                        },
+                        pass::PassProperty::REQUIRE_STATIC_SHAPE,
+                        {op::Negative::type_info});
+}
+
+TEST(pattern, graph_rewrite_worklist)
+{
+    Shape shape{};
+    auto make_function = [&shape]() {
+        auto a = make_shared<op::Parameter>(element::i32, shape);
+        auto neg = make_shared<op::Negative>(a);
+        return make_shared<Function>(construct_constant_node(0) - neg, ParameterVector{a});
+    };
+
+    {
+        auto f = make_function();
+        pass::GraphRewrite rewrite;
+        rewrite.set_use_worklist(false);
+        negation_rewrites(rewrite);
+        rewrite.run_on_function(f);
+        // A single sweep does not see the node created by the first rewrite
+        EXPECT_EQ(count_ops_of_type<op::Negative>(f), 2);
+    }
+
+    {
+        auto f = make_function();
+        pass::GraphRewrite rewrite;
+        rewrite.set_use_worklist(true);
+        negation_rewrites(rewrite);
+        rewrite.run_on_function(f);
+        EXPECT_EQ(count_ops_of_type<op::Negative>(f), 0);
+        EXPECT_EQ(f->get_results().at(0)->get_argument(0), f->get_parameters().at(0));
+    }
+}
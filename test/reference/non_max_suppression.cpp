@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Corner boxes [y1, x1, y2, x2]. Box 1 overlaps box 0 by half its width, an IoU of 1/3, and
+// box 2 overlaps neither.
+static const vector<float> s_boxes{0, 0, 1, 1, 0, 0.5f, 1, 1.5f, 0, 2, 1, 3};
+
+TEST(reference, soft_non_max_suppression_decays_scores)
+{
+    runtime::reference::NMSParameters params;
+    params.iou_threshold = 1.0f;
+    // Decay factor exp(-0.5 * iou^2 / sigma) = exp(-iou^2)
+    params.soft_nms_sigma = 0.5f;
+
+    vector<float> scores{0.9f, 0.75f, 0.7f};
+    vector<runtime::reference::NMSSelection> selected;
+    runtime::reference::non_max_suppression_class(
+        s_boxes.data(), scores.data(), 3, 1, params, selected);
+
+    // Box 1 decays to 0.75 * exp(-1/9) = 0.671 once box 0 is kept, so box 2 overtakes it
+    ASSERT_EQ(selected.size(), 3);
+    EXPECT_EQ(selected[0].box, 0);
+    EXPECT_FLOAT_EQ(selected[0].score, 0.9f);
+    EXPECT_EQ(selected[1].box, 2);
+    EXPECT_FLOAT_EQ(selected[1].score, 0.7f);
+    EXPECT_EQ(selected[2].box, 1);
+    EXPECT_FLOAT_EQ(selected[2].score, 0.75f * exp(-1.0f / 9));
+
+    // A decayed score at or below the threshold drops the box
+    params.score_threshold = 0.68f;
+    runtime::reference::non_max_suppression_class(
+        s_boxes.data(), scores.data(), 3, 1, params, selected);
+    ASSERT_EQ(selected.size(), 2);
+    EXPECT_EQ(selected[0].box, 0);
+    EXPECT_EQ(selected[1].box, 2);
+}
+
+TEST(reference, non_max_suppression_truncates_to_output_rows)
+{
+    runtime::reference::NMSParameters params;
+    params.max_selected = 3;
+    params.iou_threshold = 0.5f;
+
+    // Both batches keep all three boxes, but NonMaxSuppression-1 sizes its output as
+    // min(num_boxes, max_output_boxes_per_class * classes) rows, which drops the second batch
+    vector<float> boxes = s_boxes;
+    boxes.insert(boxes.end(), s_boxes.begin(), s_boxes.end());
+    vector<float> scores{0.9f, 0.75f, 0.7f, 0.9f, 0.75f, 0.7f};
+    vector<int64_t> output(9);
+    runtime::reference::non_max_suppression(
+        boxes.data(), scores.data(), Shape{2, 1, 3}, params, false, output.data(), 3);
+
+    EXPECT_EQ((vector<int64_t>{0, 0, 0, 0, 0, 1, 0, 0, 2}), output);
+}
@@ -27,7 +27,9 @@
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/interpolate.hpp"
 #include "ngraph/op/passthrough.hpp"
+#include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -216,11 +218,206 @@ TEST(benchmark, serialize)
     out << serialize(f, 4);
 }
 
+TEST(benchmark, ordered_ops)
+{
+    const string json_path = file_util::path_join(SERIALIZED_ZOO, "mxnet/LSTM_backward.json");
+    shared_ptr<Function> f = ngraph::deserialize(file_util::read_file_to_string(json_path));
+    constexpr size_t num_iterations = 100;
+    stopwatch timer;
+
+    // Sorting from scratch, as every call did before the order was cached
+    vector<shared_ptr<Node>> roots(f->get_results().begin(), f->get_results().end());
+    roots.insert(roots.end(), f->get_parameters().begin(), f->get_parameters().end());
+    timer.start();
+    vector<shared_ptr<Node>> sorted;
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        sorted = topological_sort(roots);
+    }
+    timer.stop();
+    cout << num_iterations << " topological sorts of " << sorted.size() << " ops took "
+         << timer.get_milliseconds() << "ms\n";
+
+    timer.start();
+    vector<shared_ptr<Node>> cached;
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        cached = f->get_ordered_ops();
+    }
+    timer.stop();
+    cout << num_iterations << " cached get_ordered_ops took " << timer.get_milliseconds()
+         << "ms\n";
+    EXPECT_EQ(cached, f->get_ordered_ops());
+
+    // Analysis passes that each walk the order, first with a sort that also edits an unrelated
+    // graph. The epoch then moves during every sort, so each get_ordered_ops sorts from
+    // scratch as it did before the order was cached.
+    shared_ptr<Function> uncached = ngraph::deserialize(file_util::read_file_to_string(json_path));
+    auto a = make_shared<op::Parameter>(element::f32, Shape{});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{});
+    uncached->set_topological_sort([a, b](const vector<shared_ptr<Node>>& nodes) {
+        b->add_control_dependency(a);
+        b->remove_control_dependency(a);
+        return topological_sort(nodes);
+    });
+    pass::Manager uncached_pass_manager;
+    uncached_pass_manager.register_pass<pass::Liveness>();
+    uncached_pass_manager.register_pass<pass::MemoryLayout>();
+    timer.start();
+    uncached_pass_manager.run_passes(uncached);
+    timer.stop();
+    cout << "Liveness and MemoryLayout without the cache took " << timer.get_milliseconds()
+         << "ms\n";
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    timer.start();
+    pass_manager.run_passes(f);
+    timer.stop();
+    cout << "Liveness and MemoryLayout took " << timer.get_milliseconds() << "ms\n";
+    EXPECT_EQ(uncached->get_temporary_pool_size(), f->get_temporary_pool_size());
+}
+
 MATCHER_P2(IsOutputShape, type, shape, "")
 {
     return std::get<0>(arg) == type && std::get<1>(arg).to_shape() == shape;
 }
 
+static shared_ptr<Function> make_binary_test_function()
+{
+    auto p = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto weights = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    // Shares its data with weights
+    auto weights_copy = make_shared<op::Constant>(*weights);
+    auto fill = op::Constant::create(element::i64, Shape{3}, {7, 7, 7});
+    auto sum = make_shared<op::Add>(make_shared<op::Add>(p, weights), weights_copy);
+    auto converted = make_shared<op::Convert>(fill, element::f32);
+    auto bias = make_shared<op::Broadcast>(converted, Shape{2, 3}, AxisSet{0});
+    return make_shared<Function>(make_shared<op::Multiply>(sum, bias), ParameterVector{p});
+}
+
+static void check_binary_test_function(const shared_ptr<Function>& g)
+{
+    ASSERT_THAT(g, NotNull());
+    vector<shared_ptr<op::Constant>> constants;
+    for (auto& node : g->get_ordered_ops())
+    {
+        if (auto c = as_type_ptr<op::Constant>(node))
+        {
+            constants.push_back(c);
+            // Used in place from the aligned data section
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(c->get_data_ptr()) % 64, 0);
+        }
+    }
+    ASSERT_EQ(constants.size(), 3);
+    size_t f32_count = 0;
+    for (auto& c : constants)
+    {
+        if (c->get_element_type() == element::f32)
+        {
+            EXPECT_EQ(c->get_vector<float>(), (vector<float>{1, 2, 3, 4, 5, 6}));
+            f32_count++;
+        }
+        else
+        {
+            EXPECT_EQ(c->get_element_type(), element::i64);
+            EXPECT_EQ(c->get_vector<int64_t>(), (vector<int64_t>{7, 7, 7}));
+        }
+    }
+    EXPECT_EQ(f32_count, 2);
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(g), 1);
+    EXPECT_EQ(g->get_output_shape(0), (Shape{2, 3}));
+}
+
+TEST(serialize, binary_file)
+{
+    const string tmp_file = "serialize_binary_file.ngb";
+    auto f = make_binary_test_function();
+    serialize_binary(tmp_file, f);
+    EXPECT_TRUE(is_binary_model(tmp_file));
+
+    auto g = deserialize(tmp_file);
+    file_util::remove_file(tmp_file);
+    check_binary_test_function(g);
+
+    // The copies of weights still share one payload after loading
+    vector<const void*> f32_data;
+    for (auto& node : g->get_ops())
+    {
+        if (auto c = as_type_ptr<op::Constant>(node))
+        {
+            if (c->get_element_type() == element::f32)
+            {
+                f32_data.push_back(c->get_data_ptr());
+            }
+        }
+    }
+    ASSERT_EQ(f32_data.size(), 2);
+    EXPECT_EQ(f32_data[0], f32_data[1]);
+}
+
+TEST(serialize, binary_stream)
+{
+    auto f = make_binary_test_function();
+    stringstream ss;
+    serialize_binary(ss, f);
+    check_binary_test_function(deserialize(ss));
+
+    const string tmp_file = "serialize_binary_stream.json";
+    serialize(tmp_file, f);
+    EXPECT_FALSE(is_binary_model(tmp_file));
+    file_util::remove_file(tmp_file);
+}
+
+TEST(serialize, streaming_json)
+{
+    auto p = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto weights =
+        op::Constant::create(element::f32, Shape{2, 3}, vector<float>{1.5, -2, 3, 4, 5, 6});
+    // Written as a single broadcast literal
+    auto fill = op::Constant::create(element::i64, Shape{2, 3}, {7, 7, 7, 7, 7, 7});
+    auto mask = op::Constant::create(element::boolean, Shape{2, 3}, {1, 0, 1, 1, 0, 0});
+    auto sum = make_shared<op::Add>(p, weights);
+    auto bias = make_shared<op::Convert>(fill, element::f32);
+    auto select = make_shared<op::Select>(mask, sum, bias);
+    auto f = make_shared<Function>(select, ParameterVector{p});
+
+    string js = serialize(f);
+    stringstream ss(js);
+    for (auto g : {deserialize(ss), deserialize(js)})
+    {
+        ASSERT_THAT(g, NotNull());
+        EXPECT_EQ(g->get_output_shape(0), (Shape{2, 3}));
+        size_t constants = 0;
+        for (auto& node : g->get_ordered_ops())
+        {
+            auto c = as_type_ptr<op::Constant>(node);
+            if (!c)
+            {
+                continue;
+            }
+            constants++;
+            if (c->get_element_type() == element::f32)
+            {
+                EXPECT_EQ(c->get_vector<float>(), (vector<float>{1.5, -2, 3, 4, 5, 6}));
+            }
+            else if (c->get_element_type() == element::i64)
+            {
+                EXPECT_EQ(c->get_vector<int64_t>(), (vector<int64_t>{7, 7, 7, 7, 7, 7}));
+            }
+            else
+            {
+                EXPECT_EQ(c->get_element_type(), element::boolean);
+                EXPECT_EQ(c->get_vector<char>(), (vector<char>{1, 0, 1, 1, 0, 0}));
+            }
+        }
+        EXPECT_EQ(constants, 3);
+    }
+
+    EXPECT_ANY_THROW(deserialize(js.substr(0, js.size() / 2)));
+}
+
 TEST(serialize, passthrough)
 {
     const string tmp_file = "serialize_passthrough.json";
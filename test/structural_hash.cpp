@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/structural_hash.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_function(size_t softmax_axis = 1,
+                                          float bias = 1.0f,
+                                          const Coordinate& slice_upper = Coordinate{2, 3},
+                                          bool swap_operands = false)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto K = op::Constant::create(element::f32, Shape{2, 4}, vector<float>(8, bias));
+    auto sub = swap_operands ? make_shared<op::Subtract>(B, A) : make_shared<op::Subtract>(A, B);
+    auto softmax = make_shared<op::v1::Softmax>(sub + K, softmax_axis);
+    auto slice = make_shared<op::Slice>(softmax, Coordinate{0, 0}, slice_upper);
+    return make_shared<Function>(slice, ParameterVector{A, B});
+}
+
+static string signature_of(const shared_ptr<Function>& f)
+{
+    string signature;
+    EXPECT_TRUE(get_structural_signature(*f, signature));
+    return signature;
+}
+
+TEST(structural_hash, separately_built_functions_match)
+{
+    auto f = make_function();
+    auto g = make_function();
+    EXPECT_EQ(signature_of(f), signature_of(g));
+
+    uint64_t f_hash;
+    uint64_t g_hash;
+    ASSERT_TRUE(get_structural_hash(*f, f_hash));
+    ASSERT_TRUE(get_structural_hash(*g, g_hash));
+    EXPECT_EQ(f_hash, g_hash);
+    EXPECT_TRUE(constant_data_equal(*f, *g));
+
+    // Names are not part of the structure
+    f->get_results()[0]->get_input_node_shared_ptr(0)->set_friendly_name("sliced");
+    EXPECT_EQ(signature_of(f), signature_of(g));
+}
+
+TEST(structural_hash, differences_are_detected)
+{
+    string reference = signature_of(make_function());
+    // Attribute reached through the attribute visitor
+    EXPECT_NE(reference, signature_of(make_function(0)));
+    // Attribute of an op without an attribute visitor
+    EXPECT_NE(reference, signature_of(make_function(1, 1.0f, Coordinate{2, 2})));
+    // Wiring
+    EXPECT_NE(reference, signature_of(make_function(1, 1.0f, Coordinate{2, 3}, true)));
+}
+
+TEST(structural_hash, constant_data)
+{
+    auto f = make_function(1, 1.0f);
+    auto g = make_function(1, 2.0f);
+    EXPECT_NE(signature_of(f), signature_of(g));
+    EXPECT_FALSE(constant_data_equal(*f, *g));
+}
+
+TEST(structural_hash, shapes_and_types)
+{
+    auto make = [](const element::Type& type, const Shape& shape) {
+        auto A = make_shared<op::Parameter>(type, shape);
+        return make_shared<Function>(make_shared<op::Abs>(A), ParameterVector{A});
+    };
+    string reference = signature_of(make(element::f32, Shape{2, 3}));
+    EXPECT_EQ(reference, signature_of(make(element::f32, Shape{2, 3})));
+    EXPECT_NE(reference, signature_of(make(element::f32, Shape{3, 2})));
+    EXPECT_NE(reference, signature_of(make(element::f64, Shape{2, 3})));
+}
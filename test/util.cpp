@@ -14,13 +14,18 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
 #include <fstream>
+#include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
 
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -712,3 +717,108 @@ TEST(util, topological_sort_replace)
 
     EXPECT_TRUE(custom_sorter_used);
 }
+
+TEST(util, ordered_ops_cache)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto f = make_shared<Function>(add * B, ParameterVector{A, B});
+    size_t sort_count = 0;
+    f->set_topological_sort([&sort_count](const std::vector<std::shared_ptr<Node>>& root_nodes) {
+        sort_count++;
+        return topological_sort(root_nodes);
+    });
+
+    auto ops = f->get_ordered_ops();
+    uint64_t epoch = f->get_topology_epoch();
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+    EXPECT_EQ(sort_count, 1);
+    EXPECT_EQ(f->get_topology_epoch(), epoch);
+
+    // Rewiring an edge drops the cached order
+    auto sub = make_shared<op::Subtract>(A, B);
+    replace_node(add, sub);
+    EXPECT_NE(f->get_topology_epoch(), epoch);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(sort_count, 2);
+    EXPECT_EQ(count(ops.begin(), ops.end(), sub), 1);
+    EXPECT_EQ(count(ops.begin(), ops.end(), add), 0);
+
+    // So does a control dependency
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto neg = make_shared<op::Negative>(C);
+    sub->add_control_dependency(neg);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(sort_count, 3);
+    EXPECT_LT(find(ops.begin(), ops.end(), neg) - ops.begin(),
+              find(ops.begin(), ops.end(), sub) - ops.begin());
+
+    // And replacing a parameter
+    auto D = make_shared<op::Parameter>(element::f32, shape);
+    f->replace_parameter(0, D);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(sort_count, 4);
+    EXPECT_EQ(count(ops.begin(), ops.end(), A), 0);
+    EXPECT_EQ(count(ops.begin(), ops.end(), D), 1);
+}
+
+TEST(util, chrome_trace_threads)
+{
+    const string trace_file = "util_chrome_trace_threads.json";
+    bool was_enabled = event::Manager::is_event_tracing_enabled();
+    event::Manager::enable_event_tracing();
+    event::Manager::open(trace_file);
+
+    const size_t thread_count = 4;
+    const size_t event_count = 1000;
+    // All threads are alive at once, so each has its own id
+    atomic<size_t> started{0};
+    vector<thread> threads;
+    for (size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&]() {
+            started++;
+            while (started < thread_count)
+            {
+                this_thread::yield();
+            }
+            for (size_t i = 0; i < event_count; ++i)
+            {
+                event::Duration d("traced", "util", i == 0 ? R"({"first":true})" : "");
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    event::Manager::close();
+    if (!was_enabled)
+    {
+        event::Manager::disable_event_tracing();
+    }
+
+    ifstream in(trace_file);
+    nlohmann::json events = nlohmann::json::parse(in);
+    in.close();
+    file_util::remove_file(trace_file);
+    size_t traced = 0;
+    size_t with_args = 0;
+    set<string> tids;
+    for (auto& e : events)
+    {
+        if (e.at("name") == "traced")
+        {
+            EXPECT_EQ(e.at("ph"), "X");
+            EXPECT_EQ(e.at("cat"), "util");
+            traced++;
+            with_args += e.count("args");
+            tids.insert(e.at("tid").get<string>());
+        }
+    }
+    EXPECT_EQ(traced, thread_count * event_count);
+    EXPECT_EQ(with_args, thread_count);
+    EXPECT_EQ(tids.size(), thread_count);
+}